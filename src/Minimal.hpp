@@ -22,6 +22,7 @@
 #ifndef FAST_DDS_GENERATED__MINIMAL_HPP
 #define FAST_DDS_GENERATED__MINIMAL_HPP
 
+#include <array>
 #include <cstdint>
 #include <utility>
 #include <vector>
@@ -51,6 +52,8 @@
 #define MINIMAL_DllAPI
 #endif // _WIN32
 
+const uint32_t MINIMAL_FRAME_CAPACITY = 8388608;
+
 /*!
  * @brief This class represents the structure Minimal defined by the user in the IDL file.
  * @ingroup Minimal
@@ -80,10 +83,16 @@ public:
     eProsima_user_DllExport Minimal(
             const Minimal& x)
     {
+                    m_stream_id = x.m_stream_id;
+
                     m_index = x.m_index;
 
                     m_time_stamp = x.m_time_stamp;
 
+                    m_raw_size = x.m_raw_size;
+
+                    m_codec = x.m_codec;
+
                     m_img_data = x.m_img_data;
 
     }
@@ -95,8 +104,11 @@ public:
     eProsima_user_DllExport Minimal(
             Minimal&& x) noexcept
     {
+        m_stream_id = x.m_stream_id;
         m_index = x.m_index;
         m_time_stamp = x.m_time_stamp;
+        m_raw_size = x.m_raw_size;
+        m_codec = x.m_codec;
         m_img_data = std::move(x.m_img_data);
     }
 
@@ -108,10 +120,16 @@ public:
             const Minimal& x)
     {
 
+                    m_stream_id = x.m_stream_id;
+
                     m_index = x.m_index;
 
                     m_time_stamp = x.m_time_stamp;
 
+                    m_raw_size = x.m_raw_size;
+
+                    m_codec = x.m_codec;
+
                     m_img_data = x.m_img_data;
 
         return *this;
@@ -125,8 +143,11 @@ public:
             Minimal&& x) noexcept
     {
 
+        m_stream_id = x.m_stream_id;
         m_index = x.m_index;
         m_time_stamp = x.m_time_stamp;
+        m_raw_size = x.m_raw_size;
+        m_codec = x.m_codec;
         m_img_data = std::move(x.m_img_data);
         return *this;
     }
@@ -138,8 +159,11 @@ public:
     eProsima_user_DllExport bool operator ==(
             const Minimal& x) const
     {
-        return (m_index == x.m_index &&
+        return (m_stream_id == x.m_stream_id &&
+           m_index == x.m_index &&
            m_time_stamp == x.m_time_stamp &&
+           m_raw_size == x.m_raw_size &&
+           m_codec == x.m_codec &&
            m_img_data == x.m_img_data);
     }
 
@@ -153,6 +177,35 @@ public:
         return !(*this == x);
     }
 
+    /*!
+     * @brief This function sets a value in member stream_id
+     * @param _stream_id New value for member stream_id
+     */
+    eProsima_user_DllExport void stream_id(
+            uint32_t _stream_id)
+    {
+        m_stream_id = _stream_id;
+    }
+
+    /*!
+     * @brief This function returns the value of member stream_id
+     * @return Value of member stream_id
+     */
+    eProsima_user_DllExport uint32_t stream_id() const
+    {
+        return m_stream_id;
+    }
+
+    /*!
+     * @brief This function returns a reference to member stream_id
+     * @return Reference to member stream_id
+     */
+    eProsima_user_DllExport uint32_t& stream_id()
+    {
+        return m_stream_id;
+    }
+
+
     /*!
      * @brief This function sets a value in member index
      * @param _index New value for member index
@@ -187,7 +240,7 @@ public:
      * @param _time_stamp New value for member time_stamp
      */
     eProsima_user_DllExport void time_stamp(
-            uint32_t _time_stamp)
+            uint64_t _time_stamp)
     {
         m_time_stamp = _time_stamp;
     }
@@ -196,7 +249,7 @@ public:
      * @brief This function returns the value of member time_stamp
      * @return Value of member time_stamp
      */
-    eProsima_user_DllExport uint32_t time_stamp() const
+    eProsima_user_DllExport uint64_t time_stamp() const
     {
         return m_time_stamp;
     }
@@ -205,12 +258,70 @@ public:
      * @brief This function returns a reference to member time_stamp
      * @return Reference to member time_stamp
      */
-    eProsima_user_DllExport uint32_t& time_stamp()
+    eProsima_user_DllExport uint64_t& time_stamp()
     {
         return m_time_stamp;
     }
 
 
+    /*!
+     * @brief This function sets a value in member raw_size
+     * @param _raw_size New value for member raw_size
+     */
+    eProsima_user_DllExport void raw_size(
+            uint32_t _raw_size)
+    {
+        m_raw_size = _raw_size;
+    }
+
+    /*!
+     * @brief This function returns the value of member raw_size
+     * @return Value of member raw_size
+     */
+    eProsima_user_DllExport uint32_t raw_size() const
+    {
+        return m_raw_size;
+    }
+
+    /*!
+     * @brief This function returns a reference to member raw_size
+     * @return Reference to member raw_size
+     */
+    eProsima_user_DllExport uint32_t& raw_size()
+    {
+        return m_raw_size;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member codec
+     * @param _codec New value for member codec
+     */
+    eProsima_user_DllExport void codec(
+            uint8_t _codec)
+    {
+        m_codec = _codec;
+    }
+
+    /*!
+     * @brief This function returns the value of member codec
+     * @return Value of member codec
+     */
+    eProsima_user_DllExport uint8_t codec() const
+    {
+        return m_codec;
+    }
+
+    /*!
+     * @brief This function returns a reference to member codec
+     * @return Reference to member codec
+     */
+    eProsima_user_DllExport uint8_t& codec()
+    {
+        return m_codec;
+    }
+
+
     /*!
      * @brief This function copies the value in member img_data
      * @param _img_data New value to be copied in member img_data
@@ -253,12 +364,1406 @@ public:
 
 private:
 
+    uint32_t m_stream_id{0};
     uint32_t m_index{0};
-    uint32_t m_time_stamp{0};
+    uint64_t m_time_stamp{0};
+    uint32_t m_raw_size{0};
+    uint8_t m_codec{0};
     std::vector<uint8_t> m_img_data;
 
 };
 
+/*!
+ * @brief This class represents the structure MinimalFrame defined by the user in the IDL file.
+ * @ingroup Minimal
+ */
+class MinimalFrame
+{
+public:
+
+    /*!
+     * @brief Default constructor.
+     */
+    eProsima_user_DllExport MinimalFrame()
+    {
+    }
+
+    /*!
+     * @brief Default destructor.
+     */
+    eProsima_user_DllExport ~MinimalFrame()
+    {
+    }
+
+    /*!
+     * @brief Copy constructor.
+     * @param x Reference to the object MinimalFrame that will be copied.
+     */
+    eProsima_user_DllExport MinimalFrame(
+            const MinimalFrame& x)
+    {
+                    m_time_stamp = x.m_time_stamp;
+
+                    m_stream_id = x.m_stream_id;
+
+                    m_index = x.m_index;
+
+                    m_img_size = x.m_img_size;
+
+                    m_img_data = x.m_img_data;
+
+    }
+
+    /*!
+     * @brief Move constructor.
+     * @param x Reference to the object MinimalFrame that will be copied.
+     */
+    eProsima_user_DllExport MinimalFrame(
+            MinimalFrame&& x) noexcept
+    {
+        m_time_stamp = x.m_time_stamp;
+        m_stream_id = x.m_stream_id;
+        m_index = x.m_index;
+        m_img_size = x.m_img_size;
+        m_img_data = std::move(x.m_img_data);
+    }
+
+    /*!
+     * @brief Copy assignment.
+     * @param x Reference to the object MinimalFrame that will be copied.
+     */
+    eProsima_user_DllExport MinimalFrame& operator =(
+            const MinimalFrame& x)
+    {
+
+                    m_time_stamp = x.m_time_stamp;
+
+                    m_stream_id = x.m_stream_id;
+
+                    m_index = x.m_index;
+
+                    m_img_size = x.m_img_size;
+
+                    m_img_data = x.m_img_data;
+
+        return *this;
+    }
+
+    /*!
+     * @brief Move assignment.
+     * @param x Reference to the object MinimalFrame that will be copied.
+     */
+    eProsima_user_DllExport MinimalFrame& operator =(
+            MinimalFrame&& x) noexcept
+    {
+
+        m_time_stamp = x.m_time_stamp;
+        m_stream_id = x.m_stream_id;
+        m_index = x.m_index;
+        m_img_size = x.m_img_size;
+        m_img_data = std::move(x.m_img_data);
+        return *this;
+    }
+
+    /*!
+     * @brief Comparison operator.
+     * @param x MinimalFrame object to compare.
+     */
+    eProsima_user_DllExport bool operator ==(
+            const MinimalFrame& x) const
+    {
+        return (m_time_stamp == x.m_time_stamp &&
+           m_stream_id == x.m_stream_id &&
+           m_index == x.m_index &&
+           m_img_size == x.m_img_size &&
+           m_img_data == x.m_img_data);
+    }
+
+    /*!
+     * @brief Comparison operator.
+     * @param x MinimalFrame object to compare.
+     */
+    eProsima_user_DllExport bool operator !=(
+            const MinimalFrame& x) const
+    {
+        return !(*this == x);
+    }
+
+    /*!
+     * @brief This function sets a value in member time_stamp
+     * @param _time_stamp New value for member time_stamp
+     */
+    eProsima_user_DllExport void time_stamp(
+            uint64_t _time_stamp)
+    {
+        m_time_stamp = _time_stamp;
+    }
+
+    /*!
+     * @brief This function returns the value of member time_stamp
+     * @return Value of member time_stamp
+     */
+    eProsima_user_DllExport uint64_t time_stamp() const
+    {
+        return m_time_stamp;
+    }
+
+    /*!
+     * @brief This function returns a reference to member time_stamp
+     * @return Reference to member time_stamp
+     */
+    eProsima_user_DllExport uint64_t& time_stamp()
+    {
+        return m_time_stamp;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member stream_id
+     * @param _stream_id New value for member stream_id
+     */
+    eProsima_user_DllExport void stream_id(
+            uint32_t _stream_id)
+    {
+        m_stream_id = _stream_id;
+    }
+
+    /*!
+     * @brief This function returns the value of member stream_id
+     * @return Value of member stream_id
+     */
+    eProsima_user_DllExport uint32_t stream_id() const
+    {
+        return m_stream_id;
+    }
+
+    /*!
+     * @brief This function returns a reference to member stream_id
+     * @return Reference to member stream_id
+     */
+    eProsima_user_DllExport uint32_t& stream_id()
+    {
+        return m_stream_id;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member index
+     * @param _index New value for member index
+     */
+    eProsima_user_DllExport void index(
+            uint32_t _index)
+    {
+        m_index = _index;
+    }
+
+    /*!
+     * @brief This function returns the value of member index
+     * @return Value of member index
+     */
+    eProsima_user_DllExport uint32_t index() const
+    {
+        return m_index;
+    }
+
+    /*!
+     * @brief This function returns a reference to member index
+     * @return Reference to member index
+     */
+    eProsima_user_DllExport uint32_t& index()
+    {
+        return m_index;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member img_size
+     * @param _img_size New value for member img_size
+     */
+    eProsima_user_DllExport void img_size(
+            uint32_t _img_size)
+    {
+        m_img_size = _img_size;
+    }
+
+    /*!
+     * @brief This function returns the value of member img_size
+     * @return Value of member img_size
+     */
+    eProsima_user_DllExport uint32_t img_size() const
+    {
+        return m_img_size;
+    }
+
+    /*!
+     * @brief This function returns a reference to member img_size
+     * @return Reference to member img_size
+     */
+    eProsima_user_DllExport uint32_t& img_size()
+    {
+        return m_img_size;
+    }
+
+
+    /*!
+     * @brief This function copies the value in member img_data
+     * @param _img_data New value to be copied in member img_data
+     */
+    eProsima_user_DllExport void img_data(
+            const std::array<uint8_t, MINIMAL_FRAME_CAPACITY>& _img_data)
+    {
+        m_img_data = _img_data;
+    }
+
+    /*!
+     * @brief This function moves the value in member img_data
+     * @param _img_data New value to be moved in member img_data
+     */
+    eProsima_user_DllExport void img_data(
+            std::array<uint8_t, MINIMAL_FRAME_CAPACITY>&& _img_data)
+    {
+        m_img_data = std::move(_img_data);
+    }
+
+    /*!
+     * @brief This function returns a constant reference to member img_data
+     * @return Constant reference to member img_data
+     */
+    eProsima_user_DllExport const std::array<uint8_t, MINIMAL_FRAME_CAPACITY>& img_data() const
+    {
+        return m_img_data;
+    }
+
+    /*!
+     * @brief This function returns a reference to member img_data
+     * @return Reference to member img_data
+     */
+    eProsima_user_DllExport std::array<uint8_t, MINIMAL_FRAME_CAPACITY>& img_data()
+    {
+        return m_img_data;
+    }
+
+
+
+private:
+
+    uint64_t m_time_stamp{0};
+    uint32_t m_stream_id{0};
+    uint32_t m_index{0};
+    uint32_t m_img_size{0};
+    std::array<uint8_t, MINIMAL_FRAME_CAPACITY> m_img_data{0};
+
+};
+
+/*!
+ * @brief This class represents the structure MinimalChunk defined by the user in the IDL file.
+ * @ingroup Minimal
+ */
+class MinimalChunk
+{
+public:
+
+    /*!
+     * @brief Default constructor.
+     */
+    eProsima_user_DllExport MinimalChunk()
+    {
+    }
+
+    /*!
+     * @brief Default destructor.
+     */
+    eProsima_user_DllExport ~MinimalChunk()
+    {
+    }
+
+    /*!
+     * @brief Copy constructor.
+     * @param x Reference to the object MinimalChunk that will be copied.
+     */
+    eProsima_user_DllExport MinimalChunk(
+            const MinimalChunk& x)
+    {
+                    m_stream_id = x.m_stream_id;
+
+                    m_index = x.m_index;
+
+                    m_time_stamp = x.m_time_stamp;
+
+                    m_raw_size = x.m_raw_size;
+
+                    m_codec = x.m_codec;
+
+                    m_frame_size = x.m_frame_size;
+
+                    m_offset = x.m_offset;
+
+                    m_chunk_index = x.m_chunk_index;
+
+                    m_chunk_count = x.m_chunk_count;
+
+                    m_data = x.m_data;
+
+    }
+
+    /*!
+     * @brief Move constructor.
+     * @param x Reference to the object MinimalChunk that will be copied.
+     */
+    eProsima_user_DllExport MinimalChunk(
+            MinimalChunk&& x) noexcept
+    {
+        m_stream_id = x.m_stream_id;
+        m_index = x.m_index;
+        m_time_stamp = x.m_time_stamp;
+        m_raw_size = x.m_raw_size;
+        m_codec = x.m_codec;
+        m_frame_size = x.m_frame_size;
+        m_offset = x.m_offset;
+        m_chunk_index = x.m_chunk_index;
+        m_chunk_count = x.m_chunk_count;
+        m_data = std::move(x.m_data);
+    }
+
+    /*!
+     * @brief Copy assignment.
+     * @param x Reference to the object MinimalChunk that will be copied.
+     */
+    eProsima_user_DllExport MinimalChunk& operator =(
+            const MinimalChunk& x)
+    {
+
+                    m_stream_id = x.m_stream_id;
+
+                    m_index = x.m_index;
+
+                    m_time_stamp = x.m_time_stamp;
+
+                    m_raw_size = x.m_raw_size;
+
+                    m_codec = x.m_codec;
+
+                    m_frame_size = x.m_frame_size;
+
+                    m_offset = x.m_offset;
+
+                    m_chunk_index = x.m_chunk_index;
+
+                    m_chunk_count = x.m_chunk_count;
+
+                    m_data = x.m_data;
+
+        return *this;
+    }
+
+    /*!
+     * @brief Move assignment.
+     * @param x Reference to the object MinimalChunk that will be copied.
+     */
+    eProsima_user_DllExport MinimalChunk& operator =(
+            MinimalChunk&& x) noexcept
+    {
+
+        m_stream_id = x.m_stream_id;
+        m_index = x.m_index;
+        m_time_stamp = x.m_time_stamp;
+        m_raw_size = x.m_raw_size;
+        m_codec = x.m_codec;
+        m_frame_size = x.m_frame_size;
+        m_offset = x.m_offset;
+        m_chunk_index = x.m_chunk_index;
+        m_chunk_count = x.m_chunk_count;
+        m_data = std::move(x.m_data);
+        return *this;
+    }
+
+    /*!
+     * @brief Comparison operator.
+     * @param x MinimalChunk object to compare.
+     */
+    eProsima_user_DllExport bool operator ==(
+            const MinimalChunk& x) const
+    {
+        return (m_stream_id == x.m_stream_id &&
+           m_index == x.m_index &&
+           m_time_stamp == x.m_time_stamp &&
+           m_raw_size == x.m_raw_size &&
+           m_codec == x.m_codec &&
+           m_frame_size == x.m_frame_size &&
+           m_offset == x.m_offset &&
+           m_chunk_index == x.m_chunk_index &&
+           m_chunk_count == x.m_chunk_count &&
+           m_data == x.m_data);
+    }
+
+    /*!
+     * @brief Comparison operator.
+     * @param x MinimalChunk object to compare.
+     */
+    eProsima_user_DllExport bool operator !=(
+            const MinimalChunk& x) const
+    {
+        return !(*this == x);
+    }
+
+    /*!
+     * @brief This function sets a value in member stream_id
+     * @param _stream_id New value for member stream_id
+     */
+    eProsima_user_DllExport void stream_id(
+            uint32_t _stream_id)
+    {
+        m_stream_id = _stream_id;
+    }
+
+    /*!
+     * @brief This function returns the value of member stream_id
+     * @return Value of member stream_id
+     */
+    eProsima_user_DllExport uint32_t stream_id() const
+    {
+        return m_stream_id;
+    }
+
+    /*!
+     * @brief This function returns a reference to member stream_id
+     * @return Reference to member stream_id
+     */
+    eProsima_user_DllExport uint32_t& stream_id()
+    {
+        return m_stream_id;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member index
+     * @param _index New value for member index
+     */
+    eProsima_user_DllExport void index(
+            uint32_t _index)
+    {
+        m_index = _index;
+    }
+
+    /*!
+     * @brief This function returns the value of member index
+     * @return Value of member index
+     */
+    eProsima_user_DllExport uint32_t index() const
+    {
+        return m_index;
+    }
+
+    /*!
+     * @brief This function returns a reference to member index
+     * @return Reference to member index
+     */
+    eProsima_user_DllExport uint32_t& index()
+    {
+        return m_index;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member time_stamp
+     * @param _time_stamp New value for member time_stamp
+     */
+    eProsima_user_DllExport void time_stamp(
+            uint64_t _time_stamp)
+    {
+        m_time_stamp = _time_stamp;
+    }
+
+    /*!
+     * @brief This function returns the value of member time_stamp
+     * @return Value of member time_stamp
+     */
+    eProsima_user_DllExport uint64_t time_stamp() const
+    {
+        return m_time_stamp;
+    }
+
+    /*!
+     * @brief This function returns a reference to member time_stamp
+     * @return Reference to member time_stamp
+     */
+    eProsima_user_DllExport uint64_t& time_stamp()
+    {
+        return m_time_stamp;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member raw_size
+     * @param _raw_size New value for member raw_size
+     */
+    eProsima_user_DllExport void raw_size(
+            uint32_t _raw_size)
+    {
+        m_raw_size = _raw_size;
+    }
+
+    /*!
+     * @brief This function returns the value of member raw_size
+     * @return Value of member raw_size
+     */
+    eProsima_user_DllExport uint32_t raw_size() const
+    {
+        return m_raw_size;
+    }
+
+    /*!
+     * @brief This function returns a reference to member raw_size
+     * @return Reference to member raw_size
+     */
+    eProsima_user_DllExport uint32_t& raw_size()
+    {
+        return m_raw_size;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member codec
+     * @param _codec New value for member codec
+     */
+    eProsima_user_DllExport void codec(
+            uint8_t _codec)
+    {
+        m_codec = _codec;
+    }
+
+    /*!
+     * @brief This function returns the value of member codec
+     * @return Value of member codec
+     */
+    eProsima_user_DllExport uint8_t codec() const
+    {
+        return m_codec;
+    }
+
+    /*!
+     * @brief This function returns a reference to member codec
+     * @return Reference to member codec
+     */
+    eProsima_user_DllExport uint8_t& codec()
+    {
+        return m_codec;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member frame_size
+     * @param _frame_size New value for member frame_size
+     */
+    eProsima_user_DllExport void frame_size(
+            uint32_t _frame_size)
+    {
+        m_frame_size = _frame_size;
+    }
+
+    /*!
+     * @brief This function returns the value of member frame_size
+     * @return Value of member frame_size
+     */
+    eProsima_user_DllExport uint32_t frame_size() const
+    {
+        return m_frame_size;
+    }
+
+    /*!
+     * @brief This function returns a reference to member frame_size
+     * @return Reference to member frame_size
+     */
+    eProsima_user_DllExport uint32_t& frame_size()
+    {
+        return m_frame_size;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member offset
+     * @param _offset New value for member offset
+     */
+    eProsima_user_DllExport void offset(
+            uint32_t _offset)
+    {
+        m_offset = _offset;
+    }
+
+    /*!
+     * @brief This function returns the value of member offset
+     * @return Value of member offset
+     */
+    eProsima_user_DllExport uint32_t offset() const
+    {
+        return m_offset;
+    }
+
+    /*!
+     * @brief This function returns a reference to member offset
+     * @return Reference to member offset
+     */
+    eProsima_user_DllExport uint32_t& offset()
+    {
+        return m_offset;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member chunk_index
+     * @param _chunk_index New value for member chunk_index
+     */
+    eProsima_user_DllExport void chunk_index(
+            uint32_t _chunk_index)
+    {
+        m_chunk_index = _chunk_index;
+    }
+
+    /*!
+     * @brief This function returns the value of member chunk_index
+     * @return Value of member chunk_index
+     */
+    eProsima_user_DllExport uint32_t chunk_index() const
+    {
+        return m_chunk_index;
+    }
+
+    /*!
+     * @brief This function returns a reference to member chunk_index
+     * @return Reference to member chunk_index
+     */
+    eProsima_user_DllExport uint32_t& chunk_index()
+    {
+        return m_chunk_index;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member chunk_count
+     * @param _chunk_count New value for member chunk_count
+     */
+    eProsima_user_DllExport void chunk_count(
+            uint32_t _chunk_count)
+    {
+        m_chunk_count = _chunk_count;
+    }
+
+    /*!
+     * @brief This function returns the value of member chunk_count
+     * @return Value of member chunk_count
+     */
+    eProsima_user_DllExport uint32_t chunk_count() const
+    {
+        return m_chunk_count;
+    }
+
+    /*!
+     * @brief This function returns a reference to member chunk_count
+     * @return Reference to member chunk_count
+     */
+    eProsima_user_DllExport uint32_t& chunk_count()
+    {
+        return m_chunk_count;
+    }
+
+
+    /*!
+     * @brief This function copies the value in member data
+     * @param _data New value to be copied in member data
+     */
+    eProsima_user_DllExport void data(
+            const std::vector<uint8_t>& _data)
+    {
+        m_data = _data;
+    }
+
+    /*!
+     * @brief This function moves the value in member data
+     * @param _data New value to be moved in member data
+     */
+    eProsima_user_DllExport void data(
+            std::vector<uint8_t>&& _data)
+    {
+        m_data = std::move(_data);
+    }
+
+    /*!
+     * @brief This function returns a constant reference to member data
+     * @return Constant reference to member data
+     */
+    eProsima_user_DllExport const std::vector<uint8_t>& data() const
+    {
+        return m_data;
+    }
+
+    /*!
+     * @brief This function returns a reference to member data
+     * @return Reference to member data
+     */
+    eProsima_user_DllExport std::vector<uint8_t>& data()
+    {
+        return m_data;
+    }
+
+
+
+private:
+
+    uint32_t m_stream_id{0};
+    uint32_t m_index{0};
+    uint64_t m_time_stamp{0};
+    uint32_t m_raw_size{0};
+    uint8_t m_codec{0};
+    uint32_t m_frame_size{0};
+    uint32_t m_offset{0};
+    uint32_t m_chunk_index{0};
+    uint32_t m_chunk_count{0};
+    std::vector<uint8_t> m_data;
+
+};
+
+/*!
+ * @brief This class represents the structure MinimalStats defined by the user in the IDL file.
+ * @ingroup Minimal
+ */
+class MinimalStats
+{
+public:
+
+    /*!
+     * @brief Default constructor.
+     */
+    eProsima_user_DllExport MinimalStats()
+    {
+    }
+
+    /*!
+     * @brief Default destructor.
+     */
+    eProsima_user_DllExport ~MinimalStats()
+    {
+    }
+
+    /*!
+     * @brief Copy constructor.
+     * @param x Reference to the object MinimalStats that will be copied.
+     */
+    eProsima_user_DllExport MinimalStats(
+            const MinimalStats& x)
+    {
+                    m_source = x.m_source;
+
+                    m_matched = x.m_matched;
+
+                    m_time_stamp = x.m_time_stamp;
+
+                    m_window_s = x.m_window_s;
+
+                    m_samples = x.m_samples;
+
+                    m_total_samples = x.m_total_samples;
+
+                    m_lost = x.m_lost;
+
+                    m_total_lost = x.m_total_lost;
+
+                    m_samples_per_second = x.m_samples_per_second;
+
+                    m_mbytes_per_second = x.m_mbytes_per_second;
+
+                    m_p50_ns = x.m_p50_ns;
+
+                    m_p90_ns = x.m_p90_ns;
+
+                    m_p99_ns = x.m_p99_ns;
+
+                    m_max_ns = x.m_max_ns;
+
+                    m_role = x.m_role;
+
+    }
+
+    /*!
+     * @brief Move constructor.
+     * @param x Reference to the object MinimalStats that will be copied.
+     */
+    eProsima_user_DllExport MinimalStats(
+            MinimalStats&& x) noexcept
+    {
+        m_source = x.m_source;
+        m_matched = x.m_matched;
+        m_time_stamp = x.m_time_stamp;
+        m_window_s = x.m_window_s;
+        m_samples = x.m_samples;
+        m_total_samples = x.m_total_samples;
+        m_lost = x.m_lost;
+        m_total_lost = x.m_total_lost;
+        m_samples_per_second = x.m_samples_per_second;
+        m_mbytes_per_second = x.m_mbytes_per_second;
+        m_p50_ns = x.m_p50_ns;
+        m_p90_ns = x.m_p90_ns;
+        m_p99_ns = x.m_p99_ns;
+        m_max_ns = x.m_max_ns;
+        m_role = x.m_role;
+    }
+
+    /*!
+     * @brief Copy assignment.
+     * @param x Reference to the object MinimalStats that will be copied.
+     */
+    eProsima_user_DllExport MinimalStats& operator =(
+            const MinimalStats& x)
+    {
+
+                    m_source = x.m_source;
+
+                    m_matched = x.m_matched;
+
+                    m_time_stamp = x.m_time_stamp;
+
+                    m_window_s = x.m_window_s;
+
+                    m_samples = x.m_samples;
+
+                    m_total_samples = x.m_total_samples;
+
+                    m_lost = x.m_lost;
+
+                    m_total_lost = x.m_total_lost;
+
+                    m_samples_per_second = x.m_samples_per_second;
+
+                    m_mbytes_per_second = x.m_mbytes_per_second;
+
+                    m_p50_ns = x.m_p50_ns;
+
+                    m_p90_ns = x.m_p90_ns;
+
+                    m_p99_ns = x.m_p99_ns;
+
+                    m_max_ns = x.m_max_ns;
+
+                    m_role = x.m_role;
+
+        return *this;
+    }
+
+    /*!
+     * @brief Move assignment.
+     * @param x Reference to the object MinimalStats that will be copied.
+     */
+    eProsima_user_DllExport MinimalStats& operator =(
+            MinimalStats&& x) noexcept
+    {
+
+        m_source = x.m_source;
+        m_matched = x.m_matched;
+        m_time_stamp = x.m_time_stamp;
+        m_window_s = x.m_window_s;
+        m_samples = x.m_samples;
+        m_total_samples = x.m_total_samples;
+        m_lost = x.m_lost;
+        m_total_lost = x.m_total_lost;
+        m_samples_per_second = x.m_samples_per_second;
+        m_mbytes_per_second = x.m_mbytes_per_second;
+        m_p50_ns = x.m_p50_ns;
+        m_p90_ns = x.m_p90_ns;
+        m_p99_ns = x.m_p99_ns;
+        m_max_ns = x.m_max_ns;
+        m_role = x.m_role;
+        return *this;
+    }
+
+    /*!
+     * @brief Comparison operator.
+     * @param x MinimalStats object to compare.
+     */
+    eProsima_user_DllExport bool operator ==(
+            const MinimalStats& x) const
+    {
+        return (m_source == x.m_source &&
+           m_matched == x.m_matched &&
+           m_time_stamp == x.m_time_stamp &&
+           m_window_s == x.m_window_s &&
+           m_samples == x.m_samples &&
+           m_total_samples == x.m_total_samples &&
+           m_lost == x.m_lost &&
+           m_total_lost == x.m_total_lost &&
+           m_samples_per_second == x.m_samples_per_second &&
+           m_mbytes_per_second == x.m_mbytes_per_second &&
+           m_p50_ns == x.m_p50_ns &&
+           m_p90_ns == x.m_p90_ns &&
+           m_p99_ns == x.m_p99_ns &&
+           m_max_ns == x.m_max_ns &&
+           m_role == x.m_role);
+    }
+
+    /*!
+     * @brief Comparison operator.
+     * @param x MinimalStats object to compare.
+     */
+    eProsima_user_DllExport bool operator !=(
+            const MinimalStats& x) const
+    {
+        return !(*this == x);
+    }
+
+    /*!
+     * @brief This function sets a value in member source
+     * @param _source New value for member source
+     */
+    eProsima_user_DllExport void source(
+            uint32_t _source)
+    {
+        m_source = _source;
+    }
+
+    /*!
+     * @brief This function returns the value of member source
+     * @return Value of member source
+     */
+    eProsima_user_DllExport uint32_t source() const
+    {
+        return m_source;
+    }
+
+    /*!
+     * @brief This function returns a reference to member source
+     * @return Reference to member source
+     */
+    eProsima_user_DllExport uint32_t& source()
+    {
+        return m_source;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member matched
+     * @param _matched New value for member matched
+     */
+    eProsima_user_DllExport void matched(
+            uint32_t _matched)
+    {
+        m_matched = _matched;
+    }
+
+    /*!
+     * @brief This function returns the value of member matched
+     * @return Value of member matched
+     */
+    eProsima_user_DllExport uint32_t matched() const
+    {
+        return m_matched;
+    }
+
+    /*!
+     * @brief This function returns a reference to member matched
+     * @return Reference to member matched
+     */
+    eProsima_user_DllExport uint32_t& matched()
+    {
+        return m_matched;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member time_stamp
+     * @param _time_stamp New value for member time_stamp
+     */
+    eProsima_user_DllExport void time_stamp(
+            uint64_t _time_stamp)
+    {
+        m_time_stamp = _time_stamp;
+    }
+
+    /*!
+     * @brief This function returns the value of member time_stamp
+     * @return Value of member time_stamp
+     */
+    eProsima_user_DllExport uint64_t time_stamp() const
+    {
+        return m_time_stamp;
+    }
+
+    /*!
+     * @brief This function returns a reference to member time_stamp
+     * @return Reference to member time_stamp
+     */
+    eProsima_user_DllExport uint64_t& time_stamp()
+    {
+        return m_time_stamp;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member window_s
+     * @param _window_s New value for member window_s
+     */
+    eProsima_user_DllExport void window_s(
+            double _window_s)
+    {
+        m_window_s = _window_s;
+    }
+
+    /*!
+     * @brief This function returns the value of member window_s
+     * @return Value of member window_s
+     */
+    eProsima_user_DllExport double window_s() const
+    {
+        return m_window_s;
+    }
+
+    /*!
+     * @brief This function returns a reference to member window_s
+     * @return Reference to member window_s
+     */
+    eProsima_user_DllExport double& window_s()
+    {
+        return m_window_s;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member samples
+     * @param _samples New value for member samples
+     */
+    eProsima_user_DllExport void samples(
+            uint64_t _samples)
+    {
+        m_samples = _samples;
+    }
+
+    /*!
+     * @brief This function returns the value of member samples
+     * @return Value of member samples
+     */
+    eProsima_user_DllExport uint64_t samples() const
+    {
+        return m_samples;
+    }
+
+    /*!
+     * @brief This function returns a reference to member samples
+     * @return Reference to member samples
+     */
+    eProsima_user_DllExport uint64_t& samples()
+    {
+        return m_samples;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member total_samples
+     * @param _total_samples New value for member total_samples
+     */
+    eProsima_user_DllExport void total_samples(
+            uint64_t _total_samples)
+    {
+        m_total_samples = _total_samples;
+    }
+
+    /*!
+     * @brief This function returns the value of member total_samples
+     * @return Value of member total_samples
+     */
+    eProsima_user_DllExport uint64_t total_samples() const
+    {
+        return m_total_samples;
+    }
+
+    /*!
+     * @brief This function returns a reference to member total_samples
+     * @return Reference to member total_samples
+     */
+    eProsima_user_DllExport uint64_t& total_samples()
+    {
+        return m_total_samples;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member lost
+     * @param _lost New value for member lost
+     */
+    eProsima_user_DllExport void lost(
+            uint64_t _lost)
+    {
+        m_lost = _lost;
+    }
+
+    /*!
+     * @brief This function returns the value of member lost
+     * @return Value of member lost
+     */
+    eProsima_user_DllExport uint64_t lost() const
+    {
+        return m_lost;
+    }
+
+    /*!
+     * @brief This function returns a reference to member lost
+     * @return Reference to member lost
+     */
+    eProsima_user_DllExport uint64_t& lost()
+    {
+        return m_lost;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member total_lost
+     * @param _total_lost New value for member total_lost
+     */
+    eProsima_user_DllExport void total_lost(
+            uint64_t _total_lost)
+    {
+        m_total_lost = _total_lost;
+    }
+
+    /*!
+     * @brief This function returns the value of member total_lost
+     * @return Value of member total_lost
+     */
+    eProsima_user_DllExport uint64_t total_lost() const
+    {
+        return m_total_lost;
+    }
+
+    /*!
+     * @brief This function returns a reference to member total_lost
+     * @return Reference to member total_lost
+     */
+    eProsima_user_DllExport uint64_t& total_lost()
+    {
+        return m_total_lost;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member samples_per_second
+     * @param _samples_per_second New value for member samples_per_second
+     */
+    eProsima_user_DllExport void samples_per_second(
+            double _samples_per_second)
+    {
+        m_samples_per_second = _samples_per_second;
+    }
+
+    /*!
+     * @brief This function returns the value of member samples_per_second
+     * @return Value of member samples_per_second
+     */
+    eProsima_user_DllExport double samples_per_second() const
+    {
+        return m_samples_per_second;
+    }
+
+    /*!
+     * @brief This function returns a reference to member samples_per_second
+     * @return Reference to member samples_per_second
+     */
+    eProsima_user_DllExport double& samples_per_second()
+    {
+        return m_samples_per_second;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member mbytes_per_second
+     * @param _mbytes_per_second New value for member mbytes_per_second
+     */
+    eProsima_user_DllExport void mbytes_per_second(
+            double _mbytes_per_second)
+    {
+        m_mbytes_per_second = _mbytes_per_second;
+    }
+
+    /*!
+     * @brief This function returns the value of member mbytes_per_second
+     * @return Value of member mbytes_per_second
+     */
+    eProsima_user_DllExport double mbytes_per_second() const
+    {
+        return m_mbytes_per_second;
+    }
+
+    /*!
+     * @brief This function returns a reference to member mbytes_per_second
+     * @return Reference to member mbytes_per_second
+     */
+    eProsima_user_DllExport double& mbytes_per_second()
+    {
+        return m_mbytes_per_second;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member p50_ns
+     * @param _p50_ns New value for member p50_ns
+     */
+    eProsima_user_DllExport void p50_ns(
+            uint64_t _p50_ns)
+    {
+        m_p50_ns = _p50_ns;
+    }
+
+    /*!
+     * @brief This function returns the value of member p50_ns
+     * @return Value of member p50_ns
+     */
+    eProsima_user_DllExport uint64_t p50_ns() const
+    {
+        return m_p50_ns;
+    }
+
+    /*!
+     * @brief This function returns a reference to member p50_ns
+     * @return Reference to member p50_ns
+     */
+    eProsima_user_DllExport uint64_t& p50_ns()
+    {
+        return m_p50_ns;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member p90_ns
+     * @param _p90_ns New value for member p90_ns
+     */
+    eProsima_user_DllExport void p90_ns(
+            uint64_t _p90_ns)
+    {
+        m_p90_ns = _p90_ns;
+    }
+
+    /*!
+     * @brief This function returns the value of member p90_ns
+     * @return Value of member p90_ns
+     */
+    eProsima_user_DllExport uint64_t p90_ns() const
+    {
+        return m_p90_ns;
+    }
+
+    /*!
+     * @brief This function returns a reference to member p90_ns
+     * @return Reference to member p90_ns
+     */
+    eProsima_user_DllExport uint64_t& p90_ns()
+    {
+        return m_p90_ns;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member p99_ns
+     * @param _p99_ns New value for member p99_ns
+     */
+    eProsima_user_DllExport void p99_ns(
+            uint64_t _p99_ns)
+    {
+        m_p99_ns = _p99_ns;
+    }
+
+    /*!
+     * @brief This function returns the value of member p99_ns
+     * @return Value of member p99_ns
+     */
+    eProsima_user_DllExport uint64_t p99_ns() const
+    {
+        return m_p99_ns;
+    }
+
+    /*!
+     * @brief This function returns a reference to member p99_ns
+     * @return Reference to member p99_ns
+     */
+    eProsima_user_DllExport uint64_t& p99_ns()
+    {
+        return m_p99_ns;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member max_ns
+     * @param _max_ns New value for member max_ns
+     */
+    eProsima_user_DllExport void max_ns(
+            uint64_t _max_ns)
+    {
+        m_max_ns = _max_ns;
+    }
+
+    /*!
+     * @brief This function returns the value of member max_ns
+     * @return Value of member max_ns
+     */
+    eProsima_user_DllExport uint64_t max_ns() const
+    {
+        return m_max_ns;
+    }
+
+    /*!
+     * @brief This function returns a reference to member max_ns
+     * @return Reference to member max_ns
+     */
+    eProsima_user_DllExport uint64_t& max_ns()
+    {
+        return m_max_ns;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member role
+     * @param _role New value for member role
+     */
+    eProsima_user_DllExport void role(
+            uint8_t _role)
+    {
+        m_role = _role;
+    }
+
+    /*!
+     * @brief This function returns the value of member role
+     * @return Value of member role
+     */
+    eProsima_user_DllExport uint8_t role() const
+    {
+        return m_role;
+    }
+
+    /*!
+     * @brief This function returns a reference to member role
+     * @return Reference to member role
+     */
+    eProsima_user_DllExport uint8_t& role()
+    {
+        return m_role;
+    }
+
+
+
+private:
+
+    uint32_t m_source{0};
+    uint32_t m_matched{0};
+    uint64_t m_time_stamp{0};
+    double m_window_s{0.0};
+    uint64_t m_samples{0};
+    uint64_t m_total_samples{0};
+    uint64_t m_lost{0};
+    uint64_t m_total_lost{0};
+    double m_samples_per_second{0.0};
+    double m_mbytes_per_second{0.0};
+    uint64_t m_p50_ns{0};
+    uint64_t m_p90_ns{0};
+    uint64_t m_p99_ns{0};
+    uint64_t m_max_ns{0};
+    uint8_t m_role{0};
+
+};
+
 #endif // _FAST_DDS_GENERATED_MINIMAL_HPP_
 
 
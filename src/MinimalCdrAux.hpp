@@ -24,8 +24,17 @@
 
 #include "Minimal.hpp"
 
-constexpr uint32_t Minimal_max_cdr_typesize {16UL};
-constexpr uint32_t Minimal_max_key_cdr_typesize {0UL};
+constexpr uint32_t MinimalStats_max_cdr_typesize {109UL};
+constexpr uint32_t MinimalStats_max_key_cdr_typesize {4UL};
+
+constexpr uint32_t MinimalChunk_max_cdr_typesize {48UL};
+constexpr uint32_t MinimalChunk_max_key_cdr_typesize {4UL};
+
+constexpr uint32_t MinimalFrame_max_cdr_typesize {8388628UL};
+constexpr uint32_t MinimalFrame_max_key_cdr_typesize {4UL};
+
+constexpr uint32_t Minimal_max_cdr_typesize {32UL};
+constexpr uint32_t Minimal_max_key_cdr_typesize {4UL};
 
 
 namespace eprosima {
@@ -38,6 +47,18 @@ eProsima_user_DllExport void serialize_key(
         eprosima::fastcdr::Cdr& scdr,
         const Minimal& data);
 
+eProsima_user_DllExport void serialize_key(
+        eprosima::fastcdr::Cdr& scdr,
+        const MinimalFrame& data);
+
+eProsima_user_DllExport void serialize_key(
+        eprosima::fastcdr::Cdr& scdr,
+        const MinimalChunk& data);
+
+eProsima_user_DllExport void serialize_key(
+        eprosima::fastcdr::Cdr& scdr,
+        const MinimalStats& data);
+
 
 } // namespace fastcdr
 } // namespace eprosima
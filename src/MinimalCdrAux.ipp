@@ -51,12 +51,21 @@ eProsima_user_DllExport size_t calculate_serialized_size(
 
 
         calculated_size += calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(0),
-                data.index(), current_alignment);
+                data.stream_id(), current_alignment);
 
         calculated_size += calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(1),
-                data.time_stamp(), current_alignment);
+                data.index(), current_alignment);
 
         calculated_size += calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(2),
+                data.time_stamp(), current_alignment);
+
+        calculated_size += calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(3),
+                data.raw_size(), current_alignment);
+
+        calculated_size += calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(4),
+                data.codec(), current_alignment);
+
+        calculated_size += calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(5),
                 data.img_data(), current_alignment);
 
 
@@ -77,9 +86,12 @@ eProsima_user_DllExport void serialize(
             eprosima::fastcdr::EncodingAlgorithmFlag::PLAIN_CDR);
 
     scdr
-        << eprosima::fastcdr::MemberId(0) << data.index()
-        << eprosima::fastcdr::MemberId(1) << data.time_stamp()
-        << eprosima::fastcdr::MemberId(2) << data.img_data()
+        << eprosima::fastcdr::MemberId(0) << data.stream_id()
+        << eprosima::fastcdr::MemberId(1) << data.index()
+        << eprosima::fastcdr::MemberId(2) << data.time_stamp()
+        << eprosima::fastcdr::MemberId(3) << data.raw_size()
+        << eprosima::fastcdr::MemberId(4) << data.codec()
+        << eprosima::fastcdr::MemberId(5) << data.img_data()
 ;
     scdr.end_serialize_type(current_state);
 }
@@ -98,14 +110,26 @@ eProsima_user_DllExport void deserialize(
                 switch (mid.id)
                 {
                                         case 0:
-                                                dcdr >> data.index();
+                                                dcdr >> data.stream_id();
                                             break;
 
                                         case 1:
-                                                dcdr >> data.time_stamp();
+                                                dcdr >> data.index();
                                             break;
 
                                         case 2:
+                                                dcdr >> data.time_stamp();
+                                            break;
+
+                                        case 3:
+                                                dcdr >> data.raw_size();
+                                            break;
+
+                                        case 4:
+                                                dcdr >> data.codec();
+                                            break;
+
+                                        case 5:
                                                 dcdr >> data.img_data();
                                             break;
 
@@ -124,11 +148,463 @@ void serialize_key(
 
     static_cast<void>(scdr);
     static_cast<void>(data);
-                        scdr << data.index();
+                        scdr << data.stream_id();
+
+}
+
+
+
+template<>
+eProsima_user_DllExport size_t calculate_serialized_size(
+        eprosima::fastcdr::CdrSizeCalculator& calculator,
+        const MinimalFrame& data,
+        size_t& current_alignment)
+{
+    static_cast<void>(data);
+
+    eprosima::fastcdr::EncodingAlgorithmFlag previous_encoding = calculator.get_encoding();
+    size_t calculated_size {calculator.begin_calculate_type_serialized_size(
+                                eprosima::fastcdr::CdrVersion::XCDRv2 == calculator.get_cdr_version() ?
+                                eprosima::fastcdr::EncodingAlgorithmFlag::PLAIN_CDR2 :
+                                eprosima::fastcdr::EncodingAlgorithmFlag::PLAIN_CDR,
+                                current_alignment)};
+
+
+        calculated_size += calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(0),
+                data.time_stamp(), current_alignment);
+
+        calculated_size += calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(1),
+                data.stream_id(), current_alignment);
+
+        calculated_size += calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(2),
+                data.index(), current_alignment);
+
+        calculated_size += calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(3),
+                data.img_size(), current_alignment);
+
+        calculated_size += calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(4),
+                data.img_data(), current_alignment);
+
+
+    calculated_size += calculator.end_calculate_type_serialized_size(previous_encoding, current_alignment);
+
+    return calculated_size;
+}
+
+template<>
+eProsima_user_DllExport void serialize(
+        eprosima::fastcdr::Cdr& scdr,
+        const MinimalFrame& data)
+{
+    eprosima::fastcdr::Cdr::state current_state(scdr);
+    scdr.begin_serialize_type(current_state,
+            eprosima::fastcdr::CdrVersion::XCDRv2 == scdr.get_cdr_version() ?
+            eprosima::fastcdr::EncodingAlgorithmFlag::PLAIN_CDR2 :
+            eprosima::fastcdr::EncodingAlgorithmFlag::PLAIN_CDR);
+
+    scdr
+        << eprosima::fastcdr::MemberId(0) << data.time_stamp()
+        << eprosima::fastcdr::MemberId(1) << data.stream_id()
+        << eprosima::fastcdr::MemberId(2) << data.index()
+        << eprosima::fastcdr::MemberId(3) << data.img_size()
+        << eprosima::fastcdr::MemberId(4) << data.img_data()
+;
+    scdr.end_serialize_type(current_state);
+}
 
-                        scdr << data.time_stamp();
+template<>
+eProsima_user_DllExport void deserialize(
+        eprosima::fastcdr::Cdr& cdr,
+        MinimalFrame& data)
+{
+    cdr.deserialize_type(eprosima::fastcdr::CdrVersion::XCDRv2 == cdr.get_cdr_version() ?
+            eprosima::fastcdr::EncodingAlgorithmFlag::PLAIN_CDR2 :
+            eprosima::fastcdr::EncodingAlgorithmFlag::PLAIN_CDR,
+            [&data](eprosima::fastcdr::Cdr& dcdr, const eprosima::fastcdr::MemberId& mid) -> bool
+            {
+                bool ret_value = true;
+                switch (mid.id)
+                {
+                                        case 0:
+                                                dcdr >> data.time_stamp();
+                                            break;
 
-                        scdr << data.img_data();
+                                        case 1:
+                                                dcdr >> data.stream_id();
+                                            break;
+
+                                        case 2:
+                                                dcdr >> data.index();
+                                            break;
+
+                                        case 3:
+                                                dcdr >> data.img_size();
+                                            break;
+
+                                        case 4:
+                                                dcdr >> data.img_data();
+                                            break;
+
+                    default:
+                        ret_value = false;
+                        break;
+                }
+                return ret_value;
+            });
+}
+
+void serialize_key(
+        eprosima::fastcdr::Cdr& scdr,
+        const MinimalFrame& data)
+{
+
+    static_cast<void>(scdr);
+    static_cast<void>(data);
+                        scdr << data.stream_id();
+
+}
+
+
+
+template<>
+eProsima_user_DllExport size_t calculate_serialized_size(
+        eprosima::fastcdr::CdrSizeCalculator& calculator,
+        const MinimalChunk& data,
+        size_t& current_alignment)
+{
+    static_cast<void>(data);
+
+    eprosima::fastcdr::EncodingAlgorithmFlag previous_encoding = calculator.get_encoding();
+    size_t calculated_size {calculator.begin_calculate_type_serialized_size(
+                                eprosima::fastcdr::CdrVersion::XCDRv2 == calculator.get_cdr_version() ?
+                                eprosima::fastcdr::EncodingAlgorithmFlag::DELIMIT_CDR2 :
+                                eprosima::fastcdr::EncodingAlgorithmFlag::PLAIN_CDR,
+                                current_alignment)};
+
+
+        calculated_size += calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(0),
+                data.stream_id(), current_alignment);
+
+        calculated_size += calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(1),
+                data.index(), current_alignment);
+
+        calculated_size += calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(2),
+                data.time_stamp(), current_alignment);
+
+        calculated_size += calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(3),
+                data.raw_size(), current_alignment);
+
+        calculated_size += calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(4),
+                data.codec(), current_alignment);
+
+        calculated_size += calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(5),
+                data.frame_size(), current_alignment);
+
+        calculated_size += calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(6),
+                data.offset(), current_alignment);
+
+        calculated_size += calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(7),
+                data.chunk_index(), current_alignment);
+
+        calculated_size += calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(8),
+                data.chunk_count(), current_alignment);
+
+        calculated_size += calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(9),
+                data.data(), current_alignment);
+
+
+    calculated_size += calculator.end_calculate_type_serialized_size(previous_encoding, current_alignment);
+
+    return calculated_size;
+}
+
+template<>
+eProsima_user_DllExport void serialize(
+        eprosima::fastcdr::Cdr& scdr,
+        const MinimalChunk& data)
+{
+    eprosima::fastcdr::Cdr::state current_state(scdr);
+    scdr.begin_serialize_type(current_state,
+            eprosima::fastcdr::CdrVersion::XCDRv2 == scdr.get_cdr_version() ?
+            eprosima::fastcdr::EncodingAlgorithmFlag::DELIMIT_CDR2 :
+            eprosima::fastcdr::EncodingAlgorithmFlag::PLAIN_CDR);
+
+    scdr
+        << eprosima::fastcdr::MemberId(0) << data.stream_id()
+        << eprosima::fastcdr::MemberId(1) << data.index()
+        << eprosima::fastcdr::MemberId(2) << data.time_stamp()
+        << eprosima::fastcdr::MemberId(3) << data.raw_size()
+        << eprosima::fastcdr::MemberId(4) << data.codec()
+        << eprosima::fastcdr::MemberId(5) << data.frame_size()
+        << eprosima::fastcdr::MemberId(6) << data.offset()
+        << eprosima::fastcdr::MemberId(7) << data.chunk_index()
+        << eprosima::fastcdr::MemberId(8) << data.chunk_count()
+        << eprosima::fastcdr::MemberId(9) << data.data()
+;
+    scdr.end_serialize_type(current_state);
+}
+
+template<>
+eProsima_user_DllExport void deserialize(
+        eprosima::fastcdr::Cdr& cdr,
+        MinimalChunk& data)
+{
+    cdr.deserialize_type(eprosima::fastcdr::CdrVersion::XCDRv2 == cdr.get_cdr_version() ?
+            eprosima::fastcdr::EncodingAlgorithmFlag::DELIMIT_CDR2 :
+            eprosima::fastcdr::EncodingAlgorithmFlag::PLAIN_CDR,
+            [&data](eprosima::fastcdr::Cdr& dcdr, const eprosima::fastcdr::MemberId& mid) -> bool
+            {
+                bool ret_value = true;
+                switch (mid.id)
+                {
+                                        case 0:
+                                                dcdr >> data.stream_id();
+                                            break;
+
+                                        case 1:
+                                                dcdr >> data.index();
+                                            break;
+
+                                        case 2:
+                                                dcdr >> data.time_stamp();
+                                            break;
+
+                                        case 3:
+                                                dcdr >> data.raw_size();
+                                            break;
+
+                                        case 4:
+                                                dcdr >> data.codec();
+                                            break;
+
+                                        case 5:
+                                                dcdr >> data.frame_size();
+                                            break;
+
+                                        case 6:
+                                                dcdr >> data.offset();
+                                            break;
+
+                                        case 7:
+                                                dcdr >> data.chunk_index();
+                                            break;
+
+                                        case 8:
+                                                dcdr >> data.chunk_count();
+                                            break;
+
+                                        case 9:
+                                                dcdr >> data.data();
+                                            break;
+
+                    default:
+                        ret_value = false;
+                        break;
+                }
+                return ret_value;
+            });
+}
+
+void serialize_key(
+        eprosima::fastcdr::Cdr& scdr,
+        const MinimalChunk& data)
+{
+
+    static_cast<void>(scdr);
+    static_cast<void>(data);
+                        scdr << data.stream_id();
+
+}
+
+
+
+template<>
+eProsima_user_DllExport size_t calculate_serialized_size(
+        eprosima::fastcdr::CdrSizeCalculator& calculator,
+        const MinimalStats& data,
+        size_t& current_alignment)
+{
+    static_cast<void>(data);
+
+    eprosima::fastcdr::EncodingAlgorithmFlag previous_encoding = calculator.get_encoding();
+    size_t calculated_size {calculator.begin_calculate_type_serialized_size(
+                                eprosima::fastcdr::CdrVersion::XCDRv2 == calculator.get_cdr_version() ?
+                                eprosima::fastcdr::EncodingAlgorithmFlag::DELIMIT_CDR2 :
+                                eprosima::fastcdr::EncodingAlgorithmFlag::PLAIN_CDR,
+                                current_alignment)};
+
+
+        calculated_size += calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(0),
+                data.source(), current_alignment);
+
+        calculated_size += calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(1),
+                data.matched(), current_alignment);
+
+        calculated_size += calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(2),
+                data.time_stamp(), current_alignment);
+
+        calculated_size += calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(3),
+                data.window_s(), current_alignment);
+
+        calculated_size += calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(4),
+                data.samples(), current_alignment);
+
+        calculated_size += calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(5),
+                data.total_samples(), current_alignment);
+
+        calculated_size += calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(6),
+                data.lost(), current_alignment);
+
+        calculated_size += calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(7),
+                data.total_lost(), current_alignment);
+
+        calculated_size += calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(8),
+                data.samples_per_second(), current_alignment);
+
+        calculated_size += calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(9),
+                data.mbytes_per_second(), current_alignment);
+
+        calculated_size += calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(10),
+                data.p50_ns(), current_alignment);
+
+        calculated_size += calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(11),
+                data.p90_ns(), current_alignment);
+
+        calculated_size += calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(12),
+                data.p99_ns(), current_alignment);
+
+        calculated_size += calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(13),
+                data.max_ns(), current_alignment);
+
+        calculated_size += calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(14),
+                data.role(), current_alignment);
+
+
+    calculated_size += calculator.end_calculate_type_serialized_size(previous_encoding, current_alignment);
+
+    return calculated_size;
+}
+
+template<>
+eProsima_user_DllExport void serialize(
+        eprosima::fastcdr::Cdr& scdr,
+        const MinimalStats& data)
+{
+    eprosima::fastcdr::Cdr::state current_state(scdr);
+    scdr.begin_serialize_type(current_state,
+            eprosima::fastcdr::CdrVersion::XCDRv2 == scdr.get_cdr_version() ?
+            eprosima::fastcdr::EncodingAlgorithmFlag::DELIMIT_CDR2 :
+            eprosima::fastcdr::EncodingAlgorithmFlag::PLAIN_CDR);
+
+    scdr
+        << eprosima::fastcdr::MemberId(0) << data.source()
+        << eprosima::fastcdr::MemberId(1) << data.matched()
+        << eprosima::fastcdr::MemberId(2) << data.time_stamp()
+        << eprosima::fastcdr::MemberId(3) << data.window_s()
+        << eprosima::fastcdr::MemberId(4) << data.samples()
+        << eprosima::fastcdr::MemberId(5) << data.total_samples()
+        << eprosima::fastcdr::MemberId(6) << data.lost()
+        << eprosima::fastcdr::MemberId(7) << data.total_lost()
+        << eprosima::fastcdr::MemberId(8) << data.samples_per_second()
+        << eprosima::fastcdr::MemberId(9) << data.mbytes_per_second()
+        << eprosima::fastcdr::MemberId(10) << data.p50_ns()
+        << eprosima::fastcdr::MemberId(11) << data.p90_ns()
+        << eprosima::fastcdr::MemberId(12) << data.p99_ns()
+        << eprosima::fastcdr::MemberId(13) << data.max_ns()
+        << eprosima::fastcdr::MemberId(14) << data.role()
+;
+    scdr.end_serialize_type(current_state);
+}
+
+template<>
+eProsima_user_DllExport void deserialize(
+        eprosima::fastcdr::Cdr& cdr,
+        MinimalStats& data)
+{
+    cdr.deserialize_type(eprosima::fastcdr::CdrVersion::XCDRv2 == cdr.get_cdr_version() ?
+            eprosima::fastcdr::EncodingAlgorithmFlag::DELIMIT_CDR2 :
+            eprosima::fastcdr::EncodingAlgorithmFlag::PLAIN_CDR,
+            [&data](eprosima::fastcdr::Cdr& dcdr, const eprosima::fastcdr::MemberId& mid) -> bool
+            {
+                bool ret_value = true;
+                switch (mid.id)
+                {
+                                        case 0:
+                                                dcdr >> data.source();
+                                            break;
+
+                                        case 1:
+                                                dcdr >> data.matched();
+                                            break;
+
+                                        case 2:
+                                                dcdr >> data.time_stamp();
+                                            break;
+
+                                        case 3:
+                                                dcdr >> data.window_s();
+                                            break;
+
+                                        case 4:
+                                                dcdr >> data.samples();
+                                            break;
+
+                                        case 5:
+                                                dcdr >> data.total_samples();
+                                            break;
+
+                                        case 6:
+                                                dcdr >> data.lost();
+                                            break;
+
+                                        case 7:
+                                                dcdr >> data.total_lost();
+                                            break;
+
+                                        case 8:
+                                                dcdr >> data.samples_per_second();
+                                            break;
+
+                                        case 9:
+                                                dcdr >> data.mbytes_per_second();
+                                            break;
+
+                                        case 10:
+                                                dcdr >> data.p50_ns();
+                                            break;
+
+                                        case 11:
+                                                dcdr >> data.p90_ns();
+                                            break;
+
+                                        case 12:
+                                                dcdr >> data.p99_ns();
+                                            break;
+
+                                        case 13:
+                                                dcdr >> data.max_ns();
+                                            break;
+
+                                        case 14:
+                                                dcdr >> data.role();
+                                            break;
+
+                    default:
+                        ret_value = false;
+                        break;
+                }
+                return ret_value;
+            });
+}
+
+void serialize_key(
+        eprosima::fastcdr::Cdr& scdr,
+        const MinimalStats& data)
+{
+
+    static_cast<void>(scdr);
+    static_cast<void>(data);
+                        scdr << data.source();
 
 }
 
@@ -58,6 +58,36 @@ void register_Minimal_type_identifier(
         CompleteStructHeader header_Minimal;
         header_Minimal = TypeObjectUtils::build_complete_struct_header(TypeIdentifier(), detail_Minimal);
         CompleteStructMemberSeq member_seq_Minimal;
+        {
+            TypeIdentifierPair type_ids_stream_id;
+            ReturnCode_t return_code_stream_id {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_stream_id =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_uint32_t", type_ids_stream_id);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_stream_id)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "stream_id Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_stream_id = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, true, true, false);
+            MemberId member_id_stream_id = 0x00000000;
+            bool common_stream_id_ec {false};
+            CommonStructMember common_stream_id {TypeObjectUtils::build_common_struct_member(member_id_stream_id, member_flags_stream_id, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_stream_id, common_stream_id_ec))};
+            if (!common_stream_id_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure stream_id member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_stream_id = "stream_id";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_stream_id;
+            ann_custom_Minimal.reset();
+            CompleteMemberDetail detail_stream_id = TypeObjectUtils::build_complete_member_detail(name_stream_id, member_ann_builtin_stream_id, ann_custom_Minimal);
+            CompleteStructMember member_stream_id = TypeObjectUtils::build_complete_struct_member(common_stream_id, detail_stream_id);
+            TypeObjectUtils::add_complete_struct_member(member_seq_Minimal, member_stream_id);
+        }
         {
             TypeIdentifierPair type_ids_index;
             ReturnCode_t return_code_index {eprosima::fastdds::dds::RETCODE_OK};
@@ -73,7 +103,7 @@ void register_Minimal_type_identifier(
             }
             StructMemberFlag member_flags_index = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
                     false, false, false, false);
-            MemberId member_id_index = 0x00000000;
+            MemberId member_id_index = 0x00000001;
             bool common_index_ec {false};
             CommonStructMember common_index {TypeObjectUtils::build_common_struct_member(member_id_index, member_flags_index, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_index, common_index_ec))};
             if (!common_index_ec)
@@ -93,7 +123,7 @@ void register_Minimal_type_identifier(
             ReturnCode_t return_code_time_stamp {eprosima::fastdds::dds::RETCODE_OK};
             return_code_time_stamp =
                 eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
-                "_uint32_t", type_ids_time_stamp);
+                "_uint64_t", type_ids_time_stamp);
 
             if (eprosima::fastdds::dds::RETCODE_OK != return_code_time_stamp)
             {
@@ -103,7 +133,7 @@ void register_Minimal_type_identifier(
             }
             StructMemberFlag member_flags_time_stamp = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
                     false, false, false, false);
-            MemberId member_id_time_stamp = 0x00000001;
+            MemberId member_id_time_stamp = 0x00000002;
             bool common_time_stamp_ec {false};
             CommonStructMember common_time_stamp {TypeObjectUtils::build_common_struct_member(member_id_time_stamp, member_flags_time_stamp, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_time_stamp, common_time_stamp_ec))};
             if (!common_time_stamp_ec)
@@ -118,6 +148,66 @@ void register_Minimal_type_identifier(
             CompleteStructMember member_time_stamp = TypeObjectUtils::build_complete_struct_member(common_time_stamp, detail_time_stamp);
             TypeObjectUtils::add_complete_struct_member(member_seq_Minimal, member_time_stamp);
         }
+        {
+            TypeIdentifierPair type_ids_raw_size;
+            ReturnCode_t return_code_raw_size {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_raw_size =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_uint32_t", type_ids_raw_size);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_raw_size)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "raw_size Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_raw_size = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_raw_size = 0x00000003;
+            bool common_raw_size_ec {false};
+            CommonStructMember common_raw_size {TypeObjectUtils::build_common_struct_member(member_id_raw_size, member_flags_raw_size, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_raw_size, common_raw_size_ec))};
+            if (!common_raw_size_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure raw_size member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_raw_size = "raw_size";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_raw_size;
+            ann_custom_Minimal.reset();
+            CompleteMemberDetail detail_raw_size = TypeObjectUtils::build_complete_member_detail(name_raw_size, member_ann_builtin_raw_size, ann_custom_Minimal);
+            CompleteStructMember member_raw_size = TypeObjectUtils::build_complete_struct_member(common_raw_size, detail_raw_size);
+            TypeObjectUtils::add_complete_struct_member(member_seq_Minimal, member_raw_size);
+        }
+        {
+            TypeIdentifierPair type_ids_codec;
+            ReturnCode_t return_code_codec {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_codec =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_byte", type_ids_codec);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_codec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "codec Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_codec = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_codec = 0x00000004;
+            bool common_codec_ec {false};
+            CommonStructMember common_codec {TypeObjectUtils::build_common_struct_member(member_id_codec, member_flags_codec, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_codec, common_codec_ec))};
+            if (!common_codec_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure codec member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_codec = "codec";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_codec;
+            ann_custom_Minimal.reset();
+            CompleteMemberDetail detail_codec = TypeObjectUtils::build_complete_member_detail(name_codec, member_ann_builtin_codec, ann_custom_Minimal);
+            CompleteStructMember member_codec = TypeObjectUtils::build_complete_struct_member(common_codec, detail_codec);
+            TypeObjectUtils::add_complete_struct_member(member_seq_Minimal, member_codec);
+        }
         {
             TypeIdentifierPair type_ids_img_data;
             ReturnCode_t return_code_img_data {eprosima::fastdds::dds::RETCODE_OK};
@@ -165,7 +255,7 @@ void register_Minimal_type_identifier(
             }
             StructMemberFlag member_flags_img_data = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
                     false, false, false, false);
-            MemberId member_id_img_data = 0x00000002;
+            MemberId member_id_img_data = 0x00000005;
             bool common_img_data_ec {false};
             CommonStructMember common_img_data {TypeObjectUtils::build_common_struct_member(member_id_img_data, member_flags_img_data, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_img_data, common_img_data_ec))};
             if (!common_img_data_ec)
@@ -190,3 +280,1058 @@ void register_Minimal_type_identifier(
     }
 }
 
+// TypeIdentifier is returned by reference: dependent structures/unions are registered in this same method
+void register_MinimalFrame_type_identifier(
+        TypeIdentifierPair& type_ids_MinimalFrame)
+{
+
+    ReturnCode_t return_code_MinimalFrame {eprosima::fastdds::dds::RETCODE_OK};
+    return_code_MinimalFrame =
+        eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+        "MinimalFrame", type_ids_MinimalFrame);
+    if (eprosima::fastdds::dds::RETCODE_OK != return_code_MinimalFrame)
+    {
+        StructTypeFlag struct_flags_MinimalFrame = TypeObjectUtils::build_struct_type_flag(eprosima::fastdds::dds::xtypes::ExtensibilityKind::FINAL,
+                false, false);
+        QualifiedTypeName type_name_MinimalFrame = "MinimalFrame";
+        eprosima::fastcdr::optional<AppliedBuiltinTypeAnnotations> type_ann_builtin_MinimalFrame;
+        eprosima::fastcdr::optional<AppliedAnnotationSeq> ann_custom_MinimalFrame;
+        CompleteTypeDetail detail_MinimalFrame = TypeObjectUtils::build_complete_type_detail(type_ann_builtin_MinimalFrame, ann_custom_MinimalFrame, type_name_MinimalFrame.to_string());
+        CompleteStructHeader header_MinimalFrame;
+        header_MinimalFrame = TypeObjectUtils::build_complete_struct_header(TypeIdentifier(), detail_MinimalFrame);
+        CompleteStructMemberSeq member_seq_MinimalFrame;
+        {
+            TypeIdentifierPair type_ids_time_stamp;
+            ReturnCode_t return_code_time_stamp {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_time_stamp =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_uint64_t", type_ids_time_stamp);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_time_stamp)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "time_stamp Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_time_stamp = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_time_stamp = 0x00000000;
+            bool common_time_stamp_ec {false};
+            CommonStructMember common_time_stamp {TypeObjectUtils::build_common_struct_member(member_id_time_stamp, member_flags_time_stamp, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_time_stamp, common_time_stamp_ec))};
+            if (!common_time_stamp_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure time_stamp member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_time_stamp = "time_stamp";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_time_stamp;
+            ann_custom_MinimalFrame.reset();
+            CompleteMemberDetail detail_time_stamp = TypeObjectUtils::build_complete_member_detail(name_time_stamp, member_ann_builtin_time_stamp, ann_custom_MinimalFrame);
+            CompleteStructMember member_time_stamp = TypeObjectUtils::build_complete_struct_member(common_time_stamp, detail_time_stamp);
+            TypeObjectUtils::add_complete_struct_member(member_seq_MinimalFrame, member_time_stamp);
+        }
+        {
+            TypeIdentifierPair type_ids_stream_id;
+            ReturnCode_t return_code_stream_id {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_stream_id =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_uint32_t", type_ids_stream_id);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_stream_id)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "stream_id Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_stream_id = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, true, true, false);
+            MemberId member_id_stream_id = 0x00000001;
+            bool common_stream_id_ec {false};
+            CommonStructMember common_stream_id {TypeObjectUtils::build_common_struct_member(member_id_stream_id, member_flags_stream_id, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_stream_id, common_stream_id_ec))};
+            if (!common_stream_id_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure stream_id member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_stream_id = "stream_id";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_stream_id;
+            ann_custom_MinimalFrame.reset();
+            CompleteMemberDetail detail_stream_id = TypeObjectUtils::build_complete_member_detail(name_stream_id, member_ann_builtin_stream_id, ann_custom_MinimalFrame);
+            CompleteStructMember member_stream_id = TypeObjectUtils::build_complete_struct_member(common_stream_id, detail_stream_id);
+            TypeObjectUtils::add_complete_struct_member(member_seq_MinimalFrame, member_stream_id);
+        }
+        {
+            TypeIdentifierPair type_ids_index;
+            ReturnCode_t return_code_index {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_index =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_uint32_t", type_ids_index);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_index)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "index Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_index = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_index = 0x00000002;
+            bool common_index_ec {false};
+            CommonStructMember common_index {TypeObjectUtils::build_common_struct_member(member_id_index, member_flags_index, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_index, common_index_ec))};
+            if (!common_index_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure index member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_index = "index";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_index;
+            ann_custom_MinimalFrame.reset();
+            CompleteMemberDetail detail_index = TypeObjectUtils::build_complete_member_detail(name_index, member_ann_builtin_index, ann_custom_MinimalFrame);
+            CompleteStructMember member_index = TypeObjectUtils::build_complete_struct_member(common_index, detail_index);
+            TypeObjectUtils::add_complete_struct_member(member_seq_MinimalFrame, member_index);
+        }
+        {
+            TypeIdentifierPair type_ids_img_size;
+            ReturnCode_t return_code_img_size {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_img_size =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_uint32_t", type_ids_img_size);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_img_size)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "img_size Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_img_size = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_img_size = 0x00000003;
+            bool common_img_size_ec {false};
+            CommonStructMember common_img_size {TypeObjectUtils::build_common_struct_member(member_id_img_size, member_flags_img_size, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_img_size, common_img_size_ec))};
+            if (!common_img_size_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure img_size member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_img_size = "img_size";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_img_size;
+            ann_custom_MinimalFrame.reset();
+            CompleteMemberDetail detail_img_size = TypeObjectUtils::build_complete_member_detail(name_img_size, member_ann_builtin_img_size, ann_custom_MinimalFrame);
+            CompleteStructMember member_img_size = TypeObjectUtils::build_complete_struct_member(common_img_size, detail_img_size);
+            TypeObjectUtils::add_complete_struct_member(member_seq_MinimalFrame, member_img_size);
+        }
+        {
+            TypeIdentifierPair type_ids_img_data;
+            ReturnCode_t return_code_img_data {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_img_data =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "anonymous_array_uint8_t_8388608", type_ids_img_data);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_img_data)
+            {
+                return_code_img_data =
+                    eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                    "_byte", type_ids_img_data);
+
+                if (eprosima::fastdds::dds::RETCODE_OK != return_code_img_data)
+                {
+                    EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                            "Array element TypeIdentifier unknown to TypeObjectRegistry.");
+                    return;
+                }
+                bool element_identifier_anonymous_array_uint8_t_8388608_ec {false};
+                TypeIdentifier* element_identifier_anonymous_array_uint8_t_8388608 {new TypeIdentifier(TypeObjectUtils::retrieve_complete_type_identifier(type_ids_img_data, element_identifier_anonymous_array_uint8_t_8388608_ec))};
+                if (!element_identifier_anonymous_array_uint8_t_8388608_ec)
+                {
+                    EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Array element TypeIdentifier inconsistent.");
+                    return;
+                }
+                EquivalenceKind equiv_kind_anonymous_array_uint8_t_8388608 = EK_COMPLETE;
+                if (TK_NONE == type_ids_img_data.type_identifier2()._d())
+                {
+                    equiv_kind_anonymous_array_uint8_t_8388608 = EK_BOTH;
+                }
+                CollectionElementFlag element_flags_anonymous_array_uint8_t_8388608 = 0;
+                PlainCollectionHeader header_anonymous_array_uint8_t_8388608 = TypeObjectUtils::build_plain_collection_header(equiv_kind_anonymous_array_uint8_t_8388608, element_flags_anonymous_array_uint8_t_8388608);
+                {
+                    LBoundSeq array_bound_seq;
+                        TypeObjectUtils::add_array_dimension(array_bound_seq, static_cast<LBound>(MINIMAL_FRAME_CAPACITY));
+
+                    PlainArrayLElemDefn array_ldefn = TypeObjectUtils::build_plain_array_l_elem_defn(header_anonymous_array_uint8_t_8388608, array_bound_seq,
+                                eprosima::fastcdr::external<TypeIdentifier>(element_identifier_anonymous_array_uint8_t_8388608));
+                    if (eprosima::fastdds::dds::RETCODE_BAD_PARAMETER ==
+                            TypeObjectUtils::build_and_register_l_array_type_identifier(array_ldefn, "anonymous_array_uint8_t_8388608", type_ids_img_data))
+                    {
+                        EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                            "anonymous_array_uint8_t_8388608 already registered in TypeObjectRegistry for a different type.");
+                    }
+                }
+            }
+            StructMemberFlag member_flags_img_data = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_img_data = 0x00000004;
+            bool common_img_data_ec {false};
+            CommonStructMember common_img_data {TypeObjectUtils::build_common_struct_member(member_id_img_data, member_flags_img_data, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_img_data, common_img_data_ec))};
+            if (!common_img_data_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure img_data member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_img_data = "img_data";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_img_data;
+            ann_custom_MinimalFrame.reset();
+            CompleteMemberDetail detail_img_data = TypeObjectUtils::build_complete_member_detail(name_img_data, member_ann_builtin_img_data, ann_custom_MinimalFrame);
+            CompleteStructMember member_img_data = TypeObjectUtils::build_complete_struct_member(common_img_data, detail_img_data);
+            TypeObjectUtils::add_complete_struct_member(member_seq_MinimalFrame, member_img_data);
+        }
+        CompleteStructType struct_type_MinimalFrame = TypeObjectUtils::build_complete_struct_type(struct_flags_MinimalFrame, header_MinimalFrame, member_seq_MinimalFrame);
+        if (eprosima::fastdds::dds::RETCODE_BAD_PARAMETER ==
+                TypeObjectUtils::build_and_register_struct_type_object(struct_type_MinimalFrame, type_name_MinimalFrame.to_string(), type_ids_MinimalFrame))
+        {
+            EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                    "MinimalFrame already registered in TypeObjectRegistry for a different type.");
+        }
+    }
+}
+
+// TypeIdentifier is returned by reference: dependent structures/unions are registered in this same method
+void register_MinimalChunk_type_identifier(
+        TypeIdentifierPair& type_ids_MinimalChunk)
+{
+
+    ReturnCode_t return_code_MinimalChunk {eprosima::fastdds::dds::RETCODE_OK};
+    return_code_MinimalChunk =
+        eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+        "MinimalChunk", type_ids_MinimalChunk);
+    if (eprosima::fastdds::dds::RETCODE_OK != return_code_MinimalChunk)
+    {
+        StructTypeFlag struct_flags_MinimalChunk = TypeObjectUtils::build_struct_type_flag(eprosima::fastdds::dds::xtypes::ExtensibilityKind::APPENDABLE,
+                false, false);
+        QualifiedTypeName type_name_MinimalChunk = "MinimalChunk";
+        eprosima::fastcdr::optional<AppliedBuiltinTypeAnnotations> type_ann_builtin_MinimalChunk;
+        eprosima::fastcdr::optional<AppliedAnnotationSeq> ann_custom_MinimalChunk;
+        CompleteTypeDetail detail_MinimalChunk = TypeObjectUtils::build_complete_type_detail(type_ann_builtin_MinimalChunk, ann_custom_MinimalChunk, type_name_MinimalChunk.to_string());
+        CompleteStructHeader header_MinimalChunk;
+        header_MinimalChunk = TypeObjectUtils::build_complete_struct_header(TypeIdentifier(), detail_MinimalChunk);
+        CompleteStructMemberSeq member_seq_MinimalChunk;
+        {
+            TypeIdentifierPair type_ids_stream_id;
+            ReturnCode_t return_code_stream_id {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_stream_id =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_uint32_t", type_ids_stream_id);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_stream_id)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "stream_id Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_stream_id = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, true, true, false);
+            MemberId member_id_stream_id = 0x00000000;
+            bool common_stream_id_ec {false};
+            CommonStructMember common_stream_id {TypeObjectUtils::build_common_struct_member(member_id_stream_id, member_flags_stream_id, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_stream_id, common_stream_id_ec))};
+            if (!common_stream_id_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure stream_id member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_stream_id = "stream_id";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_stream_id;
+            ann_custom_MinimalChunk.reset();
+            CompleteMemberDetail detail_stream_id = TypeObjectUtils::build_complete_member_detail(name_stream_id, member_ann_builtin_stream_id, ann_custom_MinimalChunk);
+            CompleteStructMember member_stream_id = TypeObjectUtils::build_complete_struct_member(common_stream_id, detail_stream_id);
+            TypeObjectUtils::add_complete_struct_member(member_seq_MinimalChunk, member_stream_id);
+        }
+        {
+            TypeIdentifierPair type_ids_index;
+            ReturnCode_t return_code_index {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_index =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_uint32_t", type_ids_index);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_index)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "index Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_index = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_index = 0x00000001;
+            bool common_index_ec {false};
+            CommonStructMember common_index {TypeObjectUtils::build_common_struct_member(member_id_index, member_flags_index, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_index, common_index_ec))};
+            if (!common_index_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure index member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_index = "index";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_index;
+            ann_custom_MinimalChunk.reset();
+            CompleteMemberDetail detail_index = TypeObjectUtils::build_complete_member_detail(name_index, member_ann_builtin_index, ann_custom_MinimalChunk);
+            CompleteStructMember member_index = TypeObjectUtils::build_complete_struct_member(common_index, detail_index);
+            TypeObjectUtils::add_complete_struct_member(member_seq_MinimalChunk, member_index);
+        }
+        {
+            TypeIdentifierPair type_ids_time_stamp;
+            ReturnCode_t return_code_time_stamp {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_time_stamp =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_uint64_t", type_ids_time_stamp);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_time_stamp)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "time_stamp Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_time_stamp = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_time_stamp = 0x00000002;
+            bool common_time_stamp_ec {false};
+            CommonStructMember common_time_stamp {TypeObjectUtils::build_common_struct_member(member_id_time_stamp, member_flags_time_stamp, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_time_stamp, common_time_stamp_ec))};
+            if (!common_time_stamp_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure time_stamp member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_time_stamp = "time_stamp";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_time_stamp;
+            ann_custom_MinimalChunk.reset();
+            CompleteMemberDetail detail_time_stamp = TypeObjectUtils::build_complete_member_detail(name_time_stamp, member_ann_builtin_time_stamp, ann_custom_MinimalChunk);
+            CompleteStructMember member_time_stamp = TypeObjectUtils::build_complete_struct_member(common_time_stamp, detail_time_stamp);
+            TypeObjectUtils::add_complete_struct_member(member_seq_MinimalChunk, member_time_stamp);
+        }
+        {
+            TypeIdentifierPair type_ids_raw_size;
+            ReturnCode_t return_code_raw_size {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_raw_size =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_uint32_t", type_ids_raw_size);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_raw_size)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "raw_size Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_raw_size = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_raw_size = 0x00000003;
+            bool common_raw_size_ec {false};
+            CommonStructMember common_raw_size {TypeObjectUtils::build_common_struct_member(member_id_raw_size, member_flags_raw_size, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_raw_size, common_raw_size_ec))};
+            if (!common_raw_size_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure raw_size member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_raw_size = "raw_size";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_raw_size;
+            ann_custom_MinimalChunk.reset();
+            CompleteMemberDetail detail_raw_size = TypeObjectUtils::build_complete_member_detail(name_raw_size, member_ann_builtin_raw_size, ann_custom_MinimalChunk);
+            CompleteStructMember member_raw_size = TypeObjectUtils::build_complete_struct_member(common_raw_size, detail_raw_size);
+            TypeObjectUtils::add_complete_struct_member(member_seq_MinimalChunk, member_raw_size);
+        }
+        {
+            TypeIdentifierPair type_ids_codec;
+            ReturnCode_t return_code_codec {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_codec =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_byte", type_ids_codec);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_codec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "codec Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_codec = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_codec = 0x00000004;
+            bool common_codec_ec {false};
+            CommonStructMember common_codec {TypeObjectUtils::build_common_struct_member(member_id_codec, member_flags_codec, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_codec, common_codec_ec))};
+            if (!common_codec_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure codec member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_codec = "codec";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_codec;
+            ann_custom_MinimalChunk.reset();
+            CompleteMemberDetail detail_codec = TypeObjectUtils::build_complete_member_detail(name_codec, member_ann_builtin_codec, ann_custom_MinimalChunk);
+            CompleteStructMember member_codec = TypeObjectUtils::build_complete_struct_member(common_codec, detail_codec);
+            TypeObjectUtils::add_complete_struct_member(member_seq_MinimalChunk, member_codec);
+        }
+        {
+            TypeIdentifierPair type_ids_frame_size;
+            ReturnCode_t return_code_frame_size {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_frame_size =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_uint32_t", type_ids_frame_size);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_frame_size)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "frame_size Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_frame_size = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_frame_size = 0x00000005;
+            bool common_frame_size_ec {false};
+            CommonStructMember common_frame_size {TypeObjectUtils::build_common_struct_member(member_id_frame_size, member_flags_frame_size, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_frame_size, common_frame_size_ec))};
+            if (!common_frame_size_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure frame_size member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_frame_size = "frame_size";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_frame_size;
+            ann_custom_MinimalChunk.reset();
+            CompleteMemberDetail detail_frame_size = TypeObjectUtils::build_complete_member_detail(name_frame_size, member_ann_builtin_frame_size, ann_custom_MinimalChunk);
+            CompleteStructMember member_frame_size = TypeObjectUtils::build_complete_struct_member(common_frame_size, detail_frame_size);
+            TypeObjectUtils::add_complete_struct_member(member_seq_MinimalChunk, member_frame_size);
+        }
+        {
+            TypeIdentifierPair type_ids_offset;
+            ReturnCode_t return_code_offset {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_offset =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_uint32_t", type_ids_offset);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_offset)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "offset Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_offset = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_offset = 0x00000006;
+            bool common_offset_ec {false};
+            CommonStructMember common_offset {TypeObjectUtils::build_common_struct_member(member_id_offset, member_flags_offset, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_offset, common_offset_ec))};
+            if (!common_offset_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure offset member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_offset = "offset";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_offset;
+            ann_custom_MinimalChunk.reset();
+            CompleteMemberDetail detail_offset = TypeObjectUtils::build_complete_member_detail(name_offset, member_ann_builtin_offset, ann_custom_MinimalChunk);
+            CompleteStructMember member_offset = TypeObjectUtils::build_complete_struct_member(common_offset, detail_offset);
+            TypeObjectUtils::add_complete_struct_member(member_seq_MinimalChunk, member_offset);
+        }
+        {
+            TypeIdentifierPair type_ids_chunk_index;
+            ReturnCode_t return_code_chunk_index {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_chunk_index =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_uint32_t", type_ids_chunk_index);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_chunk_index)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "chunk_index Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_chunk_index = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_chunk_index = 0x00000007;
+            bool common_chunk_index_ec {false};
+            CommonStructMember common_chunk_index {TypeObjectUtils::build_common_struct_member(member_id_chunk_index, member_flags_chunk_index, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_chunk_index, common_chunk_index_ec))};
+            if (!common_chunk_index_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure chunk_index member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_chunk_index = "chunk_index";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_chunk_index;
+            ann_custom_MinimalChunk.reset();
+            CompleteMemberDetail detail_chunk_index = TypeObjectUtils::build_complete_member_detail(name_chunk_index, member_ann_builtin_chunk_index, ann_custom_MinimalChunk);
+            CompleteStructMember member_chunk_index = TypeObjectUtils::build_complete_struct_member(common_chunk_index, detail_chunk_index);
+            TypeObjectUtils::add_complete_struct_member(member_seq_MinimalChunk, member_chunk_index);
+        }
+        {
+            TypeIdentifierPair type_ids_chunk_count;
+            ReturnCode_t return_code_chunk_count {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_chunk_count =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_uint32_t", type_ids_chunk_count);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_chunk_count)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "chunk_count Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_chunk_count = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_chunk_count = 0x00000008;
+            bool common_chunk_count_ec {false};
+            CommonStructMember common_chunk_count {TypeObjectUtils::build_common_struct_member(member_id_chunk_count, member_flags_chunk_count, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_chunk_count, common_chunk_count_ec))};
+            if (!common_chunk_count_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure chunk_count member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_chunk_count = "chunk_count";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_chunk_count;
+            ann_custom_MinimalChunk.reset();
+            CompleteMemberDetail detail_chunk_count = TypeObjectUtils::build_complete_member_detail(name_chunk_count, member_ann_builtin_chunk_count, ann_custom_MinimalChunk);
+            CompleteStructMember member_chunk_count = TypeObjectUtils::build_complete_struct_member(common_chunk_count, detail_chunk_count);
+            TypeObjectUtils::add_complete_struct_member(member_seq_MinimalChunk, member_chunk_count);
+        }
+        {
+            TypeIdentifierPair type_ids_data;
+            ReturnCode_t return_code_data {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_data =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "anonymous_sequence_byte_unbounded", type_ids_data);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_data)
+            {
+                return_code_data =
+                    eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                    "_byte", type_ids_data);
+
+                if (eprosima::fastdds::dds::RETCODE_OK != return_code_data)
+                {
+                    EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                            "Sequence element TypeIdentifier unknown to TypeObjectRegistry.");
+                    return;
+                }
+                bool element_identifier_anonymous_sequence_byte_unbounded_ec {false};
+                TypeIdentifier* element_identifier_anonymous_sequence_byte_unbounded {new TypeIdentifier(TypeObjectUtils::retrieve_complete_type_identifier(type_ids_data, element_identifier_anonymous_sequence_byte_unbounded_ec))};
+                if (!element_identifier_anonymous_sequence_byte_unbounded_ec)
+                {
+                    EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Sequence element TypeIdentifier inconsistent.");
+                    return;
+                }
+                EquivalenceKind equiv_kind_anonymous_sequence_byte_unbounded = EK_COMPLETE;
+                if (TK_NONE == type_ids_data.type_identifier2()._d())
+                {
+                    equiv_kind_anonymous_sequence_byte_unbounded = EK_BOTH;
+                }
+                CollectionElementFlag element_flags_anonymous_sequence_byte_unbounded = 0;
+                PlainCollectionHeader header_anonymous_sequence_byte_unbounded = TypeObjectUtils::build_plain_collection_header(equiv_kind_anonymous_sequence_byte_unbounded, element_flags_anonymous_sequence_byte_unbounded);
+                {
+                    SBound bound = 0;
+                    PlainSequenceSElemDefn seq_sdefn = TypeObjectUtils::build_plain_sequence_s_elem_defn(header_anonymous_sequence_byte_unbounded, bound,
+                                eprosima::fastcdr::external<TypeIdentifier>(element_identifier_anonymous_sequence_byte_unbounded));
+                    if (eprosima::fastdds::dds::RETCODE_BAD_PARAMETER ==
+                            TypeObjectUtils::build_and_register_s_sequence_type_identifier(seq_sdefn, "anonymous_sequence_byte_unbounded", type_ids_data))
+                    {
+                        EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                            "anonymous_sequence_byte_unbounded already registered in TypeObjectRegistry for a different type.");
+                    }
+                }
+            }
+            StructMemberFlag member_flags_data = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_data = 0x00000009;
+            bool common_data_ec {false};
+            CommonStructMember common_data {TypeObjectUtils::build_common_struct_member(member_id_data, member_flags_data, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_data, common_data_ec))};
+            if (!common_data_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure data member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_data = "data";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_data;
+            ann_custom_MinimalChunk.reset();
+            CompleteMemberDetail detail_data = TypeObjectUtils::build_complete_member_detail(name_data, member_ann_builtin_data, ann_custom_MinimalChunk);
+            CompleteStructMember member_data = TypeObjectUtils::build_complete_struct_member(common_data, detail_data);
+            TypeObjectUtils::add_complete_struct_member(member_seq_MinimalChunk, member_data);
+        }
+        CompleteStructType struct_type_MinimalChunk = TypeObjectUtils::build_complete_struct_type(struct_flags_MinimalChunk, header_MinimalChunk, member_seq_MinimalChunk);
+        if (eprosima::fastdds::dds::RETCODE_BAD_PARAMETER ==
+                TypeObjectUtils::build_and_register_struct_type_object(struct_type_MinimalChunk, type_name_MinimalChunk.to_string(), type_ids_MinimalChunk))
+        {
+            EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                    "MinimalChunk already registered in TypeObjectRegistry for a different type.");
+        }
+    }
+}
+
+// TypeIdentifier is returned by reference: dependent structures/unions are registered in this same method
+void register_MinimalStats_type_identifier(
+        TypeIdentifierPair& type_ids_MinimalStats)
+{
+
+    ReturnCode_t return_code_MinimalStats {eprosima::fastdds::dds::RETCODE_OK};
+    return_code_MinimalStats =
+        eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+        "MinimalStats", type_ids_MinimalStats);
+    if (eprosima::fastdds::dds::RETCODE_OK != return_code_MinimalStats)
+    {
+        StructTypeFlag struct_flags_MinimalStats = TypeObjectUtils::build_struct_type_flag(eprosima::fastdds::dds::xtypes::ExtensibilityKind::APPENDABLE,
+                false, false);
+        QualifiedTypeName type_name_MinimalStats = "MinimalStats";
+        eprosima::fastcdr::optional<AppliedBuiltinTypeAnnotations> type_ann_builtin_MinimalStats;
+        eprosima::fastcdr::optional<AppliedAnnotationSeq> ann_custom_MinimalStats;
+        CompleteTypeDetail detail_MinimalStats = TypeObjectUtils::build_complete_type_detail(type_ann_builtin_MinimalStats, ann_custom_MinimalStats, type_name_MinimalStats.to_string());
+        CompleteStructHeader header_MinimalStats;
+        header_MinimalStats = TypeObjectUtils::build_complete_struct_header(TypeIdentifier(), detail_MinimalStats);
+        CompleteStructMemberSeq member_seq_MinimalStats;
+        {
+            TypeIdentifierPair type_ids_source;
+            ReturnCode_t return_code_source {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_source =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_uint32_t", type_ids_source);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_source)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "source Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_source = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, true, true, false);
+            MemberId member_id_source = 0x00000000;
+            bool common_source_ec {false};
+            CommonStructMember common_source {TypeObjectUtils::build_common_struct_member(member_id_source, member_flags_source, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_source, common_source_ec))};
+            if (!common_source_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure source member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_source = "source";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_source;
+            ann_custom_MinimalStats.reset();
+            CompleteMemberDetail detail_source = TypeObjectUtils::build_complete_member_detail(name_source, member_ann_builtin_source, ann_custom_MinimalStats);
+            CompleteStructMember member_source = TypeObjectUtils::build_complete_struct_member(common_source, detail_source);
+            TypeObjectUtils::add_complete_struct_member(member_seq_MinimalStats, member_source);
+        }
+        {
+            TypeIdentifierPair type_ids_matched;
+            ReturnCode_t return_code_matched {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_matched =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_uint32_t", type_ids_matched);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_matched)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "matched Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_matched = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_matched = 0x00000001;
+            bool common_matched_ec {false};
+            CommonStructMember common_matched {TypeObjectUtils::build_common_struct_member(member_id_matched, member_flags_matched, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_matched, common_matched_ec))};
+            if (!common_matched_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure matched member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_matched = "matched";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_matched;
+            ann_custom_MinimalStats.reset();
+            CompleteMemberDetail detail_matched = TypeObjectUtils::build_complete_member_detail(name_matched, member_ann_builtin_matched, ann_custom_MinimalStats);
+            CompleteStructMember member_matched = TypeObjectUtils::build_complete_struct_member(common_matched, detail_matched);
+            TypeObjectUtils::add_complete_struct_member(member_seq_MinimalStats, member_matched);
+        }
+        {
+            TypeIdentifierPair type_ids_time_stamp;
+            ReturnCode_t return_code_time_stamp {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_time_stamp =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_uint64_t", type_ids_time_stamp);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_time_stamp)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "time_stamp Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_time_stamp = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_time_stamp = 0x00000002;
+            bool common_time_stamp_ec {false};
+            CommonStructMember common_time_stamp {TypeObjectUtils::build_common_struct_member(member_id_time_stamp, member_flags_time_stamp, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_time_stamp, common_time_stamp_ec))};
+            if (!common_time_stamp_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure time_stamp member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_time_stamp = "time_stamp";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_time_stamp;
+            ann_custom_MinimalStats.reset();
+            CompleteMemberDetail detail_time_stamp = TypeObjectUtils::build_complete_member_detail(name_time_stamp, member_ann_builtin_time_stamp, ann_custom_MinimalStats);
+            CompleteStructMember member_time_stamp = TypeObjectUtils::build_complete_struct_member(common_time_stamp, detail_time_stamp);
+            TypeObjectUtils::add_complete_struct_member(member_seq_MinimalStats, member_time_stamp);
+        }
+        {
+            TypeIdentifierPair type_ids_window_s;
+            ReturnCode_t return_code_window_s {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_window_s =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_double", type_ids_window_s);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_window_s)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "window_s Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_window_s = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_window_s = 0x00000003;
+            bool common_window_s_ec {false};
+            CommonStructMember common_window_s {TypeObjectUtils::build_common_struct_member(member_id_window_s, member_flags_window_s, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_window_s, common_window_s_ec))};
+            if (!common_window_s_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure window_s member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_window_s = "window_s";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_window_s;
+            ann_custom_MinimalStats.reset();
+            CompleteMemberDetail detail_window_s = TypeObjectUtils::build_complete_member_detail(name_window_s, member_ann_builtin_window_s, ann_custom_MinimalStats);
+            CompleteStructMember member_window_s = TypeObjectUtils::build_complete_struct_member(common_window_s, detail_window_s);
+            TypeObjectUtils::add_complete_struct_member(member_seq_MinimalStats, member_window_s);
+        }
+        {
+            TypeIdentifierPair type_ids_samples;
+            ReturnCode_t return_code_samples {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_samples =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_uint64_t", type_ids_samples);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_samples)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "samples Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_samples = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_samples = 0x00000004;
+            bool common_samples_ec {false};
+            CommonStructMember common_samples {TypeObjectUtils::build_common_struct_member(member_id_samples, member_flags_samples, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_samples, common_samples_ec))};
+            if (!common_samples_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure samples member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_samples = "samples";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_samples;
+            ann_custom_MinimalStats.reset();
+            CompleteMemberDetail detail_samples = TypeObjectUtils::build_complete_member_detail(name_samples, member_ann_builtin_samples, ann_custom_MinimalStats);
+            CompleteStructMember member_samples = TypeObjectUtils::build_complete_struct_member(common_samples, detail_samples);
+            TypeObjectUtils::add_complete_struct_member(member_seq_MinimalStats, member_samples);
+        }
+        {
+            TypeIdentifierPair type_ids_total_samples;
+            ReturnCode_t return_code_total_samples {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_total_samples =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_uint64_t", type_ids_total_samples);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_total_samples)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "total_samples Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_total_samples = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_total_samples = 0x00000005;
+            bool common_total_samples_ec {false};
+            CommonStructMember common_total_samples {TypeObjectUtils::build_common_struct_member(member_id_total_samples, member_flags_total_samples, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_total_samples, common_total_samples_ec))};
+            if (!common_total_samples_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure total_samples member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_total_samples = "total_samples";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_total_samples;
+            ann_custom_MinimalStats.reset();
+            CompleteMemberDetail detail_total_samples = TypeObjectUtils::build_complete_member_detail(name_total_samples, member_ann_builtin_total_samples, ann_custom_MinimalStats);
+            CompleteStructMember member_total_samples = TypeObjectUtils::build_complete_struct_member(common_total_samples, detail_total_samples);
+            TypeObjectUtils::add_complete_struct_member(member_seq_MinimalStats, member_total_samples);
+        }
+        {
+            TypeIdentifierPair type_ids_lost;
+            ReturnCode_t return_code_lost {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_lost =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_uint64_t", type_ids_lost);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_lost)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "lost Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_lost = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_lost = 0x00000006;
+            bool common_lost_ec {false};
+            CommonStructMember common_lost {TypeObjectUtils::build_common_struct_member(member_id_lost, member_flags_lost, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_lost, common_lost_ec))};
+            if (!common_lost_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure lost member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_lost = "lost";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_lost;
+            ann_custom_MinimalStats.reset();
+            CompleteMemberDetail detail_lost = TypeObjectUtils::build_complete_member_detail(name_lost, member_ann_builtin_lost, ann_custom_MinimalStats);
+            CompleteStructMember member_lost = TypeObjectUtils::build_complete_struct_member(common_lost, detail_lost);
+            TypeObjectUtils::add_complete_struct_member(member_seq_MinimalStats, member_lost);
+        }
+        {
+            TypeIdentifierPair type_ids_total_lost;
+            ReturnCode_t return_code_total_lost {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_total_lost =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_uint64_t", type_ids_total_lost);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_total_lost)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "total_lost Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_total_lost = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_total_lost = 0x00000007;
+            bool common_total_lost_ec {false};
+            CommonStructMember common_total_lost {TypeObjectUtils::build_common_struct_member(member_id_total_lost, member_flags_total_lost, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_total_lost, common_total_lost_ec))};
+            if (!common_total_lost_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure total_lost member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_total_lost = "total_lost";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_total_lost;
+            ann_custom_MinimalStats.reset();
+            CompleteMemberDetail detail_total_lost = TypeObjectUtils::build_complete_member_detail(name_total_lost, member_ann_builtin_total_lost, ann_custom_MinimalStats);
+            CompleteStructMember member_total_lost = TypeObjectUtils::build_complete_struct_member(common_total_lost, detail_total_lost);
+            TypeObjectUtils::add_complete_struct_member(member_seq_MinimalStats, member_total_lost);
+        }
+        {
+            TypeIdentifierPair type_ids_samples_per_second;
+            ReturnCode_t return_code_samples_per_second {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_samples_per_second =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_double", type_ids_samples_per_second);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_samples_per_second)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "samples_per_second Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_samples_per_second = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_samples_per_second = 0x00000008;
+            bool common_samples_per_second_ec {false};
+            CommonStructMember common_samples_per_second {TypeObjectUtils::build_common_struct_member(member_id_samples_per_second, member_flags_samples_per_second, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_samples_per_second, common_samples_per_second_ec))};
+            if (!common_samples_per_second_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure samples_per_second member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_samples_per_second = "samples_per_second";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_samples_per_second;
+            ann_custom_MinimalStats.reset();
+            CompleteMemberDetail detail_samples_per_second = TypeObjectUtils::build_complete_member_detail(name_samples_per_second, member_ann_builtin_samples_per_second, ann_custom_MinimalStats);
+            CompleteStructMember member_samples_per_second = TypeObjectUtils::build_complete_struct_member(common_samples_per_second, detail_samples_per_second);
+            TypeObjectUtils::add_complete_struct_member(member_seq_MinimalStats, member_samples_per_second);
+        }
+        {
+            TypeIdentifierPair type_ids_mbytes_per_second;
+            ReturnCode_t return_code_mbytes_per_second {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_mbytes_per_second =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_double", type_ids_mbytes_per_second);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_mbytes_per_second)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "mbytes_per_second Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_mbytes_per_second = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_mbytes_per_second = 0x00000009;
+            bool common_mbytes_per_second_ec {false};
+            CommonStructMember common_mbytes_per_second {TypeObjectUtils::build_common_struct_member(member_id_mbytes_per_second, member_flags_mbytes_per_second, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_mbytes_per_second, common_mbytes_per_second_ec))};
+            if (!common_mbytes_per_second_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure mbytes_per_second member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_mbytes_per_second = "mbytes_per_second";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_mbytes_per_second;
+            ann_custom_MinimalStats.reset();
+            CompleteMemberDetail detail_mbytes_per_second = TypeObjectUtils::build_complete_member_detail(name_mbytes_per_second, member_ann_builtin_mbytes_per_second, ann_custom_MinimalStats);
+            CompleteStructMember member_mbytes_per_second = TypeObjectUtils::build_complete_struct_member(common_mbytes_per_second, detail_mbytes_per_second);
+            TypeObjectUtils::add_complete_struct_member(member_seq_MinimalStats, member_mbytes_per_second);
+        }
+        {
+            TypeIdentifierPair type_ids_p50_ns;
+            ReturnCode_t return_code_p50_ns {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_p50_ns =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_uint64_t", type_ids_p50_ns);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_p50_ns)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "p50_ns Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_p50_ns = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_p50_ns = 0x0000000a;
+            bool common_p50_ns_ec {false};
+            CommonStructMember common_p50_ns {TypeObjectUtils::build_common_struct_member(member_id_p50_ns, member_flags_p50_ns, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_p50_ns, common_p50_ns_ec))};
+            if (!common_p50_ns_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure p50_ns member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_p50_ns = "p50_ns";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_p50_ns;
+            ann_custom_MinimalStats.reset();
+            CompleteMemberDetail detail_p50_ns = TypeObjectUtils::build_complete_member_detail(name_p50_ns, member_ann_builtin_p50_ns, ann_custom_MinimalStats);
+            CompleteStructMember member_p50_ns = TypeObjectUtils::build_complete_struct_member(common_p50_ns, detail_p50_ns);
+            TypeObjectUtils::add_complete_struct_member(member_seq_MinimalStats, member_p50_ns);
+        }
+        {
+            TypeIdentifierPair type_ids_p90_ns;
+            ReturnCode_t return_code_p90_ns {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_p90_ns =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_uint64_t", type_ids_p90_ns);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_p90_ns)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "p90_ns Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_p90_ns = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_p90_ns = 0x0000000b;
+            bool common_p90_ns_ec {false};
+            CommonStructMember common_p90_ns {TypeObjectUtils::build_common_struct_member(member_id_p90_ns, member_flags_p90_ns, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_p90_ns, common_p90_ns_ec))};
+            if (!common_p90_ns_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure p90_ns member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_p90_ns = "p90_ns";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_p90_ns;
+            ann_custom_MinimalStats.reset();
+            CompleteMemberDetail detail_p90_ns = TypeObjectUtils::build_complete_member_detail(name_p90_ns, member_ann_builtin_p90_ns, ann_custom_MinimalStats);
+            CompleteStructMember member_p90_ns = TypeObjectUtils::build_complete_struct_member(common_p90_ns, detail_p90_ns);
+            TypeObjectUtils::add_complete_struct_member(member_seq_MinimalStats, member_p90_ns);
+        }
+        {
+            TypeIdentifierPair type_ids_p99_ns;
+            ReturnCode_t return_code_p99_ns {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_p99_ns =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_uint64_t", type_ids_p99_ns);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_p99_ns)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "p99_ns Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_p99_ns = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_p99_ns = 0x0000000c;
+            bool common_p99_ns_ec {false};
+            CommonStructMember common_p99_ns {TypeObjectUtils::build_common_struct_member(member_id_p99_ns, member_flags_p99_ns, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_p99_ns, common_p99_ns_ec))};
+            if (!common_p99_ns_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure p99_ns member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_p99_ns = "p99_ns";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_p99_ns;
+            ann_custom_MinimalStats.reset();
+            CompleteMemberDetail detail_p99_ns = TypeObjectUtils::build_complete_member_detail(name_p99_ns, member_ann_builtin_p99_ns, ann_custom_MinimalStats);
+            CompleteStructMember member_p99_ns = TypeObjectUtils::build_complete_struct_member(common_p99_ns, detail_p99_ns);
+            TypeObjectUtils::add_complete_struct_member(member_seq_MinimalStats, member_p99_ns);
+        }
+        {
+            TypeIdentifierPair type_ids_max_ns;
+            ReturnCode_t return_code_max_ns {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_max_ns =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_uint64_t", type_ids_max_ns);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_max_ns)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "max_ns Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_max_ns = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_max_ns = 0x0000000d;
+            bool common_max_ns_ec {false};
+            CommonStructMember common_max_ns {TypeObjectUtils::build_common_struct_member(member_id_max_ns, member_flags_max_ns, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_max_ns, common_max_ns_ec))};
+            if (!common_max_ns_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure max_ns member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_max_ns = "max_ns";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_max_ns;
+            ann_custom_MinimalStats.reset();
+            CompleteMemberDetail detail_max_ns = TypeObjectUtils::build_complete_member_detail(name_max_ns, member_ann_builtin_max_ns, ann_custom_MinimalStats);
+            CompleteStructMember member_max_ns = TypeObjectUtils::build_complete_struct_member(common_max_ns, detail_max_ns);
+            TypeObjectUtils::add_complete_struct_member(member_seq_MinimalStats, member_max_ns);
+        }
+        {
+            TypeIdentifierPair type_ids_role;
+            ReturnCode_t return_code_role {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_role =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_byte", type_ids_role);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_role)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "role Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_role = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_role = 0x0000000e;
+            bool common_role_ec {false};
+            CommonStructMember common_role {TypeObjectUtils::build_common_struct_member(member_id_role, member_flags_role, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_role, common_role_ec))};
+            if (!common_role_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure role member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_role = "role";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_role;
+            ann_custom_MinimalStats.reset();
+            CompleteMemberDetail detail_role = TypeObjectUtils::build_complete_member_detail(name_role, member_ann_builtin_role, ann_custom_MinimalStats);
+            CompleteStructMember member_role = TypeObjectUtils::build_complete_struct_member(common_role, detail_role);
+            TypeObjectUtils::add_complete_struct_member(member_seq_MinimalStats, member_role);
+        }
+        CompleteStructType struct_type_MinimalStats = TypeObjectUtils::build_complete_struct_type(struct_flags_MinimalStats, header_MinimalStats, member_seq_MinimalStats);
+        if (eprosima::fastdds::dds::RETCODE_BAD_PARAMETER ==
+                TypeObjectUtils::build_and_register_struct_type_object(struct_type_MinimalStats, type_name_MinimalStats.to_string(), type_ids_MinimalStats))
+        {
+            EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                    "MinimalStats already registered in TypeObjectRegistry for a different type.");
+        }
+    }
+}
@@ -0,0 +1,797 @@
+// Optional compression of img_data: LZ4 and zstd when built in (MINIMAL_HAVE_LZ4, MINIMAL_HAVE_ZSTD)
+
+#ifndef FRAME_CODEC_HPP
+#define FRAME_CODEC_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef MINIMAL_HAVE_LZ4
+#include <lz4.h>
+#endif
+#ifdef MINIMAL_HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+enum class Compression
+{
+    NONE,       // Frames are sent raw
+    LZ4,        // Every frame is compressed with LZ4
+    ZSTD,       // Every frame is compressed with zstd
+    AUTO        // Best available codec, skipped for small frames and while the ratio is poor
+};
+
+// Value of Minimal::codec, tells the receivers how img_data is encoded
+enum class Codec : uint8_t
+{
+    NONE = 0,
+    LZ4 = 1,
+    ZSTD = 2
+};
+
+struct CompressionConfig
+{
+    Compression mode = Compression::NONE;
+    int level = 0;                      // zstd level, LZ4 acceleration, 0: codec default
+    uint32_t min_size = 64 * 1024;      // auto: smaller frames are sent raw
+    double min_ratio = 1.2;             // auto: a worse raw/compressed ratio pauses compression
+    uint32_t threads = 1;               // Threads working on the chunks of one frame
+    uint32_t chunk_size = 1024 * 1024;  // Frames are split in independently compressed chunks
+};
+
+inline bool parse_compression(
+        const char* text,
+        Compression& mode)
+{
+    const std::string value(text);
+    if (value == "none")
+    {
+        mode = Compression::NONE;
+    }
+    else if (value == "lz4")
+    {
+        mode = Compression::LZ4;
+    }
+    else if (value == "zstd")
+    {
+        mode = Compression::ZSTD;
+    }
+    else if (value == "auto")
+    {
+        mode = Compression::AUTO;
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+inline const char* codec_name(
+        Codec codec)
+{
+    switch (codec)
+    {
+        case Codec::NONE:
+            return "none";
+        case Codec::LZ4:
+            return "lz4";
+        case Codec::ZSTD:
+            return "zstd";
+    }
+    return "unknown";
+}
+
+//!Whether this build can encode and decode codec
+inline bool codec_available(
+        Codec codec)
+{
+    switch (codec)
+    {
+        case Codec::NONE:
+            return true;
+        case Codec::LZ4:
+#ifdef MINIMAL_HAVE_LZ4
+            return true;
+#else
+            return false;
+#endif
+        case Codec::ZSTD:
+#ifdef MINIMAL_HAVE_ZSTD
+            return true;
+#else
+            return false;
+#endif
+    }
+    return false;
+}
+
+// Counters of a FrameEncoder or FrameDecoder
+struct CodecStats
+{
+    uint64_t frames = 0;                // Frames seen, compressed or not
+    uint64_t coded = 0;                 // Frames that went through the codec
+    uint64_t compressed = 0;            // Frames carried compressed
+    uint64_t failed = 0;                // Frames that could not be decoded
+    uint64_t raw_bytes = 0;
+    uint64_t wire_bytes = 0;
+    uint64_t wall_ns = 0;               // Time the caller spent in the codec
+    uint64_t busy_ns = 0;               // Codec time summed over the chunk threads (CPU cost)
+
+    void merge(
+            const CodecStats& other)
+    {
+        frames += other.frames;
+        coded += other.coded;
+        compressed += other.compressed;
+        failed += other.failed;
+        raw_bytes += other.raw_bytes;
+        wire_bytes += other.wire_bytes;
+        wall_ns += other.wall_ns;
+        busy_ns += other.busy_ns;
+    }
+
+    //!Raw bytes per byte on the wire
+    double ratio() const
+    {
+        return wire_bytes > 0 ? static_cast<double>(raw_bytes) / wire_bytes : 1.0;
+    }
+
+    //!Average time per coded frame, in microseconds
+    double wall_us() const
+    {
+        return coded > 0 ? wall_ns / 1e3 / coded : 0.0;
+    }
+
+    double busy_us() const
+    {
+        return coded > 0 ? busy_ns / 1e3 / coded : 0.0;
+    }
+
+    //!verb is "encode" or "decode"
+    std::string to_string(
+            const char* verb) const
+    {
+        std::ostringstream text;
+        text << compressed << "/" << frames << " frames compressed, ratio " << ratio() << ", " << verb << " avg "
+             << wall_us() << " us per frame (" << busy_us() << " us CPU)";
+        if (failed > 0)
+        {
+            text << ", " << failed << " failed";
+        }
+        return text.str();
+    }
+
+    std::string to_json(
+            const char* verb) const
+    {
+        std::ostringstream json;
+        json << "{\"frames\": " << frames << ", \"compressed_frames\": " << compressed
+             << ", \"compression_ratio\": " << ratio() << ", \"" << verb << "_us\": " << wall_us()
+             << ", \"" << verb << "_cpu_us\": " << busy_us() << ", \"failed_frames\": " << failed << "}";
+        return json.str();
+    }
+};
+
+// Runs the chunks of one frame on threads - 1 helper threads plus the caller.
+// The helpers are created once and sleep between frames. A helper counts as
+// active from the moment it picks up a frame (under the mutex) until it is back
+// in loop(), and a frame is only set up once no helper is active: a helper
+// late for the previous frame never claims an index of the next one.
+class ChunkWorkers
+{
+    public:
+        explicit ChunkWorkers(
+                uint32_t threads)
+            : fn_(nullptr)
+            , count_(0)
+            , next_(0)
+            , pending_(0)
+            , generation_(0)
+            , active_(0)
+            , stop_(false)
+        {
+            for (uint32_t i = 1; i < threads; ++i)
+            {
+                workers_.emplace_back(&ChunkWorkers::loop, this);
+            }
+        }
+
+        ~ChunkWorkers()
+        {
+            {
+                std::lock_guard<std::mutex> guard(mutex_);
+                stop_ = true;
+            }
+            wake_.notify_all();
+            for (std::thread& worker : workers_)
+            {
+                worker.join();
+            }
+        }
+
+        //!Call fn(i) for every i in [0, count), returns when all are done
+        void run(
+                size_t count,
+                const std::function<void(size_t)>& fn)
+        {
+            if (workers_.empty() || count <= 1)
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    fn(i);
+                }
+                return;
+            }
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                done_.wait(lock, [this]()
+                        {
+                            return active_ == 0;
+                        });
+                fn_ = &fn;
+                count_ = count;
+                pending_ = count;
+                next_ = 0;
+                ++generation_;
+            }
+            wake_.notify_all();
+            work();
+            // fn goes out of scope on return: wait for the helpers to leave work() too
+            std::unique_lock<std::mutex> lock(mutex_);
+            done_.wait(lock, [this]()
+                    {
+                        return pending_ == 0 && active_ == 0;
+                    });
+        }
+
+    private:
+
+        void work()
+        {
+            size_t i;
+            while ((i = next_.fetch_add(1)) < count_)
+            {
+                (*fn_)(i);
+                if (pending_.fetch_sub(1) == 1)
+                {
+                    std::lock_guard<std::mutex> guard(mutex_);
+                    done_.notify_all();
+                }
+            }
+        }
+
+        void loop()
+        {
+            uint64_t seen = 0;
+            while (true)
+            {
+                {
+                    std::unique_lock<std::mutex> lock(mutex_);
+                    wake_.wait(lock, [this, seen]()
+                            {
+                                return stop_ || generation_ != seen;
+                            });
+                    if (stop_)
+                    {
+                        return;
+                    }
+                    seen = generation_;
+                    ++active_;
+                }
+                work();
+                std::lock_guard<std::mutex> guard(mutex_);
+                if (--active_ == 0)
+                {
+                    done_.notify_all();
+                }
+            }
+        }
+
+        std::vector<std::thread> workers_;
+        std::mutex mutex_;
+        std::condition_variable wake_;
+        std::condition_variable done_;
+        std::atomic<const std::function<void(size_t)>*> fn_;
+        std::atomic<size_t> count_;
+        std::atomic<size_t> next_;
+        std::atomic<size_t> pending_;
+        uint64_t generation_;
+        uint32_t active_;               // Helpers between picking up a frame and returning to loop()
+        bool stop_;
+};
+
+// Compressed img_data layout, little endian:
+//   uint32 chunk_size, uint32 chunk_count, uint32 stored_size[chunk_count], chunk data...
+// Chunk i holds raw bytes [i * chunk_size, (i + 1) * chunk_size). A stored size
+// with RAW_CHUNK set is a chunk kept uncompressed because it did not shrink.
+namespace frame_codec {
+
+const uint32_t HEADER_SIZE = 8;
+const uint32_t RAW_CHUNK = 0x80000000u;
+
+inline void store_le32(
+        uint8_t* out,
+        uint32_t value)
+{
+    out[0] = static_cast<uint8_t>(value);
+    out[1] = static_cast<uint8_t>(value >> 8);
+    out[2] = static_cast<uint8_t>(value >> 16);
+    out[3] = static_cast<uint8_t>(value >> 24);
+}
+
+inline uint32_t load_le32(
+        const uint8_t* in)
+{
+    return static_cast<uint32_t>(in[0]) | (static_cast<uint32_t>(in[1]) << 8) |
+           (static_cast<uint32_t>(in[2]) << 16) | (static_cast<uint32_t>(in[3]) << 24);
+}
+
+inline size_t compress_bound(
+        Codec codec,
+        size_t size)
+{
+    switch (codec)
+    {
+#ifdef MINIMAL_HAVE_LZ4
+        case Codec::LZ4:
+            return static_cast<size_t>(LZ4_compressBound(static_cast<int>(size)));
+#endif
+#ifdef MINIMAL_HAVE_ZSTD
+        case Codec::ZSTD:
+            return ZSTD_compressBound(size);
+#endif
+        default:
+            return size;
+    }
+}
+
+//!Compressed size, 0 on failure. context is codec state kept across calls
+inline size_t compress(
+        Codec codec,
+        int level,
+        const uint8_t* in,
+        size_t size,
+        uint8_t* out,
+        size_t capacity,
+        void*& context)
+{
+    static_cast<void>(level);
+    static_cast<void>(in);
+    static_cast<void>(size);
+    static_cast<void>(out);
+    static_cast<void>(capacity);
+    static_cast<void>(context);
+    switch (codec)
+    {
+#ifdef MINIMAL_HAVE_LZ4
+        case Codec::LZ4:
+        {
+            int n = LZ4_compress_fast(reinterpret_cast<const char*>(in), reinterpret_cast<char*>(out),
+                            static_cast<int>(size), static_cast<int>(capacity), std::max(level, 1));
+            return n > 0 ? static_cast<size_t>(n) : 0;
+        }
+#endif
+#ifdef MINIMAL_HAVE_ZSTD
+        case Codec::ZSTD:
+        {
+            if (context == nullptr)
+            {
+                context = ZSTD_createCCtx();
+            }
+            size_t n = ZSTD_compressCCtx(static_cast<ZSTD_CCtx*>(context), out, capacity, in, size, level);
+            return ZSTD_isError(n) ? 0 : n;
+        }
+#endif
+        default:
+            return 0;
+    }
+}
+
+//!Decode exactly size raw bytes into out
+inline bool decompress(
+        Codec codec,
+        const uint8_t* in,
+        size_t stored,
+        uint8_t* out,
+        size_t size,
+        void*& context)
+{
+    static_cast<void>(in);
+    static_cast<void>(stored);
+    static_cast<void>(out);
+    static_cast<void>(size);
+    static_cast<void>(context);
+    switch (codec)
+    {
+#ifdef MINIMAL_HAVE_LZ4
+        case Codec::LZ4:
+            return LZ4_decompress_safe(reinterpret_cast<const char*>(in), reinterpret_cast<char*>(out),
+                           static_cast<int>(stored), static_cast<int>(size)) == static_cast<int>(size);
+#endif
+#ifdef MINIMAL_HAVE_ZSTD
+        case Codec::ZSTD:
+        {
+            if (context == nullptr)
+            {
+                context = ZSTD_createDCtx();
+            }
+            size_t n = ZSTD_decompressDCtx(static_cast<ZSTD_DCtx*>(context), out, size, in, stored);
+            return !ZSTD_isError(n) && n == size;
+        }
+#endif
+        default:
+            return false;
+    }
+}
+
+inline void free_context(
+        void* context,
+        bool compressor)
+{
+#ifdef MINIMAL_HAVE_ZSTD
+    if (compressor)
+    {
+        ZSTD_freeCCtx(static_cast<ZSTD_CCtx*>(context));
+    }
+    else
+    {
+        ZSTD_freeDCtx(static_cast<ZSTD_DCtx*>(context));
+    }
+#else
+    static_cast<void>(context);
+    static_cast<void>(compressor);
+#endif
+}
+
+inline uint64_t elapsed_ns(
+        std::chrono::steady_clock::time_point since)
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now() - since).count());
+}
+
+} // namespace frame_codec
+
+// Publisher side: turns a raw frame into img_data, compressed or not.
+// Chunks are compressed in parallel into buffers kept across frames. In auto
+// mode frames under min_size go raw, and a ratio under min_ratio sends the
+// next AUTO_BACKOFF_FRAMES raw before the codec is tried again. Whatever the
+// mode, a frame that does not shrink is sent raw.
+class FrameEncoder
+{
+    public:
+        static const uint32_t AUTO_BACKOFF_FRAMES = 32;
+
+        explicit FrameEncoder(
+                const CompressionConfig& config)
+            : config_(config)
+            , codec_(select_codec(config.mode))
+            , workers_(std::max<uint32_t>(config.threads, 1))
+            , backoff_(0)
+        {
+            if (config_.chunk_size == 0)
+            {
+                config_.chunk_size = CompressionConfig().chunk_size;
+            }
+        }
+
+        ~FrameEncoder()
+        {
+            for (Chunk& chunk : chunks_)
+            {
+                if (chunk.context != nullptr)
+                {
+                    frame_codec::free_context(chunk.context, true);
+                }
+            }
+        }
+
+        //!Codec chosen for the configured mode, NONE when compression is off or not built in
+        Codec codec() const
+        {
+            return codec_;
+        }
+
+        //!Fill out with size bytes of data, compressed when worth it. Returns the codec of out
+        Codec encode(
+                const uint8_t* data,
+                size_t size,
+                std::vector<uint8_t>& out)
+        {
+            ++stats_.frames;
+            stats_.raw_bytes += size;
+            bool attempt = codec_ != Codec::NONE && size > 0;
+            if (attempt && config_.mode == Compression::AUTO)
+            {
+                if (size < config_.min_size)
+                {
+                    attempt = false;
+                }
+                else if (backoff_ > 0)
+                {
+                    --backoff_;
+                    attempt = false;
+                }
+            }
+
+            if (attempt)
+            {
+                auto start = std::chrono::steady_clock::now();
+                size_t count = compress_chunks(data, size);
+                size_t wire = frame_codec::HEADER_SIZE + 4 * count;
+                for (size_t i = 0; i < count; ++i)
+                {
+                    wire += chunks_[i].stored;
+                }
+                if (wire < size)
+                {
+                    assemble(count, out);
+                }
+                ++stats_.coded;
+                stats_.wall_ns += frame_codec::elapsed_ns(start);
+
+                if (config_.mode == Compression::AUTO && static_cast<double>(size) / wire < config_.min_ratio)
+                {
+                    backoff_ = AUTO_BACKOFF_FRAMES;
+                }
+                if (wire < size)
+                {
+                    ++stats_.compressed;
+                    stats_.wire_bytes += wire;
+                    return codec_;
+                }
+            }
+
+            out.assign(data, data + size);
+            stats_.wire_bytes += size;
+            return Codec::NONE;
+        }
+
+        const CodecStats& stats() const
+        {
+            return stats_;
+        }
+
+    private:
+
+        struct Chunk
+        {
+            std::vector<uint8_t> buffer;
+            const uint8_t* data = nullptr;  // Bytes to send: buffer, or the raw chunk
+            uint32_t stored = 0;
+            bool raw = false;
+            void* context = nullptr;
+        };
+
+        static Codec select_codec(
+                Compression mode)
+        {
+            switch (mode)
+            {
+                case Compression::LZ4:
+                    return codec_available(Codec::LZ4) ? Codec::LZ4 : Codec::NONE;
+                case Compression::ZSTD:
+                    return codec_available(Codec::ZSTD) ? Codec::ZSTD : Codec::NONE;
+                case Compression::AUTO:
+                    // LZ4 first: an order of magnitude faster, the ratio matters less than the latency
+                    return codec_available(Codec::LZ4) ? Codec::LZ4 :
+                           codec_available(Codec::ZSTD) ? Codec::ZSTD : Codec::NONE;
+                case Compression::NONE:
+                    break;
+            }
+            return Codec::NONE;
+        }
+
+        //!Compress every chunk of data into chunks_, returns the chunk count
+        size_t compress_chunks(
+                const uint8_t* data,
+                size_t size)
+        {
+            const size_t chunk_size = config_.chunk_size;
+            const size_t count = (size + chunk_size - 1) / chunk_size;
+            if (chunks_.size() < count)
+            {
+                chunks_.resize(count);
+            }
+            std::atomic<uint64_t> busy_ns(0);
+            workers_.run(count, [&](size_t i)
+                    {
+                        auto start = std::chrono::steady_clock::now();
+                        Chunk& chunk = chunks_[i];
+                        const uint8_t* in = data + i * chunk_size;
+                        size_t n = std::min(chunk_size, size - i * chunk_size);
+                        size_t capacity = frame_codec::compress_bound(codec_, n);
+                        if (chunk.buffer.size() < capacity)
+                        {
+                            chunk.buffer.resize(capacity);
+                        }
+                        size_t stored = frame_codec::compress(codec_, config_.level, in, n, chunk.buffer.data(),
+                                        capacity, chunk.context);
+                        chunk.raw = stored == 0 || stored >= n;
+                        chunk.data = chunk.raw ? in : chunk.buffer.data();
+                        chunk.stored = static_cast<uint32_t>(chunk.raw ? n : stored);
+                        busy_ns.fetch_add(frame_codec::elapsed_ns(start), std::memory_order_relaxed);
+                    });
+            stats_.busy_ns += busy_ns.load();
+            return count;
+        }
+
+        //!Header, chunk table and chunks into out (its capacity is reused)
+        void assemble(
+                size_t count,
+                std::vector<uint8_t>& out)
+        {
+            uint8_t word[4];
+            out.clear();
+            frame_codec::store_le32(word, config_.chunk_size);
+            out.insert(out.end(), word, word + 4);
+            frame_codec::store_le32(word, static_cast<uint32_t>(count));
+            out.insert(out.end(), word, word + 4);
+            for (size_t i = 0; i < count; ++i)
+            {
+                frame_codec::store_le32(word, chunks_[i].stored | (chunks_[i].raw ? frame_codec::RAW_CHUNK : 0));
+                out.insert(out.end(), word, word + 4);
+            }
+            for (size_t i = 0; i < count; ++i)
+            {
+                out.insert(out.end(), chunks_[i].data, chunks_[i].data + chunks_[i].stored);
+            }
+        }
+
+        CompressionConfig config_;
+        Codec codec_;
+        ChunkWorkers workers_;
+        std::vector<Chunk> chunks_;
+        uint32_t backoff_;
+        CodecStats stats_;
+};
+
+// Receive side: gives back the raw frame of a sample, decoding its chunks in
+// parallel into a buffer reused across frames. The frame header comes from the
+// wire: chunks larger than the configured chunk size, and frames that decode
+// to more than max_raw_size, are refused before the buffer grows for them.
+class FrameDecoder
+{
+    public:
+        FrameDecoder(
+                const CompressionConfig& config,
+                uint32_t max_raw_size)
+            : workers_(std::max<uint32_t>(config.threads, 1))
+            , chunk_size_(config.chunk_size)
+            , max_raw_size_(max_raw_size)
+        {
+        }
+
+        ~FrameDecoder()
+        {
+            for (void* context : contexts_)
+            {
+                if (context != nullptr)
+                {
+                    frame_codec::free_context(context, false);
+                }
+            }
+        }
+
+        //!Raw bytes of img_data: data itself when not compressed, nullptr if it cannot be decoded
+        const uint8_t* decode(
+                uint8_t codec,
+                const uint8_t* data,
+                size_t size,
+                uint32_t raw_size)
+        {
+            ++stats_.frames;
+            stats_.wire_bytes += size;
+            if (static_cast<Codec>(codec) == Codec::NONE)
+            {
+                stats_.raw_bytes += size;
+                return data;
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            const uint8_t* raw = decode_chunks(static_cast<Codec>(codec), data, size, raw_size);
+            ++stats_.coded;
+            stats_.wall_ns += frame_codec::elapsed_ns(start);
+            if (raw == nullptr)
+            {
+                ++stats_.failed;
+                return nullptr;
+            }
+            ++stats_.compressed;
+            stats_.raw_bytes += raw_size;
+            return raw;
+        }
+
+        const CodecStats& stats() const
+        {
+            return stats_;
+        }
+
+    private:
+
+        const uint8_t* decode_chunks(
+                Codec codec,
+                const uint8_t* data,
+                size_t size,
+                uint32_t raw_size)
+        {
+            if (size < frame_codec::HEADER_SIZE)
+            {
+                return nullptr;
+            }
+            const size_t chunk_size = frame_codec::load_le32(data);
+            const size_t count = frame_codec::load_le32(data + 4);
+            if (chunk_size == 0 || chunk_size > chunk_size_ || raw_size > max_raw_size_ ||
+                    count != (raw_size + chunk_size - 1) / chunk_size || count > (size - frame_codec::HEADER_SIZE) / 4)
+            {
+                return nullptr;
+            }
+
+            // Where each chunk starts, checked against size before any thread reads it
+            offsets_.resize(count + 1);
+            offsets_[0] = frame_codec::HEADER_SIZE + 4 * count;
+            for (size_t i = 0; i < count; ++i)
+            {
+                uint32_t stored = frame_codec::load_le32(data + frame_codec::HEADER_SIZE + 4 * i) &
+                        ~frame_codec::RAW_CHUNK;
+                offsets_[i + 1] = offsets_[i] + stored;
+                if (offsets_[i + 1] > size)
+                {
+                    return nullptr;
+                }
+            }
+            if (contexts_.size() < count)
+            {
+                contexts_.resize(count, nullptr);
+            }
+            raw_.resize(raw_size);
+
+            std::atomic<bool> ok(true);
+            std::atomic<uint64_t> busy_ns(0);
+            workers_.run(count, [&](size_t i)
+                    {
+                        auto start = std::chrono::steady_clock::now();
+                        const uint8_t* in = data + offsets_[i];
+                        size_t stored = offsets_[i + 1] - offsets_[i];
+                        size_t n = std::min(chunk_size, raw_size - i * chunk_size);
+                        uint8_t* out = raw_.data() + i * chunk_size;
+                        bool raw_chunk = (frame_codec::load_le32(data + frame_codec::HEADER_SIZE + 4 * i) &
+                        frame_codec::RAW_CHUNK) != 0;
+                        if (raw_chunk ? stored == n : frame_codec::decompress(codec, in, stored, out, n, contexts_[i]))
+                        {
+                            if (raw_chunk)
+                            {
+                                std::memcpy(out, in, n);
+                            }
+                        }
+                        else
+                        {
+                            ok = false;
+                        }
+                        busy_ns.fetch_add(frame_codec::elapsed_ns(start), std::memory_order_relaxed);
+                    });
+            stats_.busy_ns += busy_ns.load();
+            return ok ? raw_.data() : nullptr;
+        }
+
+        ChunkWorkers workers_;
+        uint32_t chunk_size_;
+        uint32_t max_raw_size_;
+        std::vector<uint8_t> raw_;
+        std::vector<size_t> offsets_;
+        std::vector<void*> contexts_;
+        CodecStats stats_;
+};
+
+#endif // FRAME_CODEC_HPP
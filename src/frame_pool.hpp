@@ -0,0 +1,161 @@
+// Pool of reusable Minimal samples with preallocated img_data buffers
+
+#ifndef FRAME_POOL_HPP
+#define FRAME_POOL_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <vector>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "Minimal.hpp"
+
+struct FramePoolStats
+{
+    uint64_t allocated;     // Samples created with new (pool empty)
+    uint64_t reused;        // Samples handed out again from the pool
+    uint64_t released;      // Samples given back to the pool
+    uint64_t grown;         // img_data buffers that had to reallocate to fit a sample
+};
+
+// Minimal::img_data is a std::vector (generated code), so the buffers cannot
+// come from a custom allocator. Instead every pooled sample reserves capacity
+// bytes once and is never freed while the pool lives: a released sample keeps
+// its buffer, and deserializing a frame that fits is a plain copy into it.
+// Buffers of 2 MB and more are marked MADV_HUGEPAGE, which large malloc
+// blocks (mmap-backed, page-aligned but for the allocator header) allow.
+// In steady state acquire()/release() do no heap allocation, the counters
+// prove it.
+class FramePool
+{
+    public:
+        explicit FramePool(
+                size_t capacity = 0)
+            : capacity_(capacity)
+            , allocated_(0)
+            , reused_(0)
+            , released_(0)
+            , grown_(0)
+        {
+        }
+
+        //!Frees every sample the pool created, including those still handed out (reported, they must not
+        //!be used any more)
+        ~FramePool()
+        {
+            if (owned_.size() != free_.size())
+            {
+                std::cout << "FramePool destroyed with " << owned_.size() - free_.size()
+                          << " sample(s) still in use" << std::endl;
+            }
+            for (Minimal* sample : owned_)
+            {
+                delete sample;
+            }
+        }
+
+        //!img_data capacity reserved by the samples created from now on
+        void set_capacity(
+                size_t capacity)
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            capacity_ = capacity;
+        }
+
+        //!Create count samples up front so the first frames do not allocate either
+        void preallocate(
+                size_t count)
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            free_.reserve(free_.size() + count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                free_.push_back(allocate());
+            }
+        }
+
+        Minimal* acquire()
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            if (free_.empty())
+            {
+                // Room for every sample in circulation, so release() never reallocates
+                free_.reserve(allocated_ + 1);
+                return allocate();
+            }
+            Minimal* sample = free_.back();
+            free_.pop_back();
+            reused_.fetch_add(1, std::memory_order_relaxed);
+            return sample;
+        }
+
+        void release(
+                Minimal* sample)
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            free_.push_back(sample);
+            released_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        //!Account for a buffer that reallocated (called by the deserializer)
+        void note_growth()
+        {
+            grown_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        FramePoolStats stats() const
+        {
+            return {allocated_.load(std::memory_order_relaxed), reused_.load(std::memory_order_relaxed),
+                    released_.load(std::memory_order_relaxed), grown_.load(std::memory_order_relaxed)};
+        }
+
+        //!Reserve capacity bytes in sample, hugepage-backed when large enough
+        static void reserve(
+                Minimal& sample,
+                size_t capacity)
+        {
+            if (capacity == 0 || sample.img_data().capacity() >= capacity)
+            {
+                return;
+            }
+            sample.img_data().reserve(capacity);
+            if (capacity >= (2u << 20))
+            {
+                static const uintptr_t page = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+                uintptr_t begin = reinterpret_cast<uintptr_t>(sample.img_data().data());
+                uintptr_t start = (begin + page - 1) & ~(page - 1);
+                uintptr_t end = (begin + capacity) & ~(page - 1);
+                if (end > start)
+                {
+                    madvise(reinterpret_cast<void*>(start), end - start, MADV_HUGEPAGE);
+                }
+            }
+        }
+
+    private:
+
+        //!Called with mutex_ held
+        Minimal* allocate()
+        {
+            Minimal* sample = new Minimal();
+            owned_.push_back(sample);
+            reserve(*sample, capacity_);
+            allocated_.fetch_add(1, std::memory_order_relaxed);
+            return sample;
+        }
+
+        std::mutex mutex_;
+        std::vector<Minimal*> free_;
+        std::vector<Minimal*> owned_;           // Every sample allocated, free or handed out
+        size_t capacity_;
+        std::atomic<uint64_t> allocated_;
+        std::atomic<uint64_t> reused_;
+        std::atomic<uint64_t> released_;
+        std::atomic<uint64_t> grown_;
+};
+
+#endif // FRAME_POOL_HPP
@@ -0,0 +1,252 @@
+// Reassembly of MinimalChunk samples into frames, with a deadline for partial frames
+
+#ifndef FRAME_REASSEMBLER_HPP
+#define FRAME_REASSEMBLER_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Minimal.hpp"
+
+// A frame being rebuilt, or the last one rebuilt (or dropped) in its slot
+struct ChunkedFrame
+{
+    enum class State
+    {
+        FREE,
+        PARTIAL,        // Some chunks missing
+        COMPLETE,       // Every chunk received, data holds the frame
+        DROPPED         // Gave up on it, its late chunks are ignored
+    };
+
+    State state = State::FREE;
+    uint32_t stream_id = 0;
+    uint32_t index = 0;
+    uint64_t time_stamp = 0;
+    uint32_t raw_size = 0;
+    uint8_t codec = 0;
+    std::vector<uint8_t> data;
+    std::vector<uint8_t> received;      // One flag per chunk
+    uint32_t chunks_received = 0;
+    uint64_t first_ns = 0;              // Arrival of the first chunk
+};
+
+struct ReassemblyStats
+{
+    uint64_t completed = 0;
+    uint64_t expired = 0;               // Partial frames dropped at the deadline
+    uint64_t evicted = 0;               // Partial frames dropped to make room for a newer one
+    uint64_t duplicates = 0;            // Chunks received twice
+    uint64_t late = 0;                  // Chunks of a frame already dropped
+    uint64_t invalid = 0;               // Chunks with inconsistent sizes, or of a frame above the limit
+
+    uint64_t dropped() const
+    {
+        return expired + evicted;
+    }
+
+    std::string to_string() const
+    {
+        std::ostringstream text;
+        text << completed << " frames reassembled, " << expired << " expired, " << evicted << " evicted, "
+             << duplicates << " duplicate, " << late << " late and " << invalid << " invalid chunks";
+        return text.str();
+    }
+
+    std::string to_json() const
+    {
+        std::ostringstream json;
+        json << "{\"frames_completed\": " << completed << ", \"frames_expired\": " << expired
+             << ", \"frames_evicted\": " << evicted << ", \"duplicate_chunks\": " << duplicates
+             << ", \"late_chunks\": " << late << ", \"invalid_chunks\": " << invalid << "}";
+        return json.str();
+    }
+};
+
+// Chunks land straight at their offset in one of a fixed set of slots, whose
+// buffers are allocated up front and reused. A frame that is still partial
+// deadline_ns after its first chunk is dropped (0: never), so a lost chunk
+// costs one frame instead of stalling the stream. When every slot is busy the
+// oldest partial frame makes room. The sizes of a chunk come from the wire:
+// it must split its frame the way chunk_size does, and frames above
+// max_frame_size are refused before anything is allocated for them. Not
+// thread safe: the reader's listener thread is the only user.
+class FrameReassembler
+{
+    public:
+        FrameReassembler(
+                uint32_t slots,
+                size_t frame_capacity,
+                uint32_t chunk_size,
+                uint32_t max_frame_size,
+                uint64_t deadline_ns)
+            : slots_(slots > 0 ? slots : 1)
+            , chunk_size_(chunk_size > 0 ? chunk_size : 1)
+            , max_frame_size_(max_frame_size)
+            , deadline_ns_(deadline_ns)
+        {
+            for (ChunkedFrame& slot : slots_)
+            {
+                slot.data.reserve(frame_capacity);
+                slot.received.reserve(chunks_of(frame_capacity));
+            }
+        }
+
+        //!Store chunk, returns its frame when this chunk completes it (valid until the next call)
+        const ChunkedFrame* add(
+                const MinimalChunk& chunk,
+                uint64_t now_ns)
+        {
+            expire(now_ns);
+
+            const uint32_t count = chunk.chunk_count();
+            const uint32_t frame_size = chunk.frame_size();
+            const uint64_t offset = static_cast<uint64_t>(chunk.chunk_index()) * chunk_size_;
+            if (frame_size > max_frame_size_ || count != chunks_of(frame_size) || chunk.chunk_index() >= count ||
+                    chunk.offset() != offset || chunk.data().size() != std::min<uint64_t>(chunk_size_,
+                    frame_size - offset))
+            {
+                ++stats_.invalid;
+                return nullptr;
+            }
+            const size_t size = chunk.data().size();
+
+            ChunkedFrame* frame = find(chunk.stream_id(), chunk.index());
+            if (frame != nullptr && frame->state != ChunkedFrame::State::PARTIAL)
+            {
+                ++(frame->state == ChunkedFrame::State::COMPLETE ? stats_.duplicates : stats_.late);
+                return nullptr;
+            }
+            if (frame == nullptr)
+            {
+                frame = &start(chunk, now_ns);
+            }
+            else if (frame->received.size() != count || frame->data.size() != chunk.frame_size())
+            {
+                ++stats_.invalid;
+                return nullptr;
+            }
+
+            if (frame->received[chunk.chunk_index()])
+            {
+                ++stats_.duplicates;
+                return nullptr;
+            }
+            if (size > 0)
+            {
+                std::memcpy(frame->data.data() + chunk.offset(), chunk.data().data(), size);
+            }
+            frame->received[chunk.chunk_index()] = 1;
+            if (++frame->chunks_received < count)
+            {
+                return nullptr;
+            }
+            frame->state = ChunkedFrame::State::COMPLETE;
+            ++stats_.completed;
+            return frame;
+        }
+
+        //!Drop the partial frames older than the deadline
+        void expire(
+                uint64_t now_ns)
+        {
+            if (deadline_ns_ == 0)
+            {
+                return;
+            }
+            for (ChunkedFrame& slot : slots_)
+            {
+                if (slot.state == ChunkedFrame::State::PARTIAL && now_ns - slot.first_ns > deadline_ns_)
+                {
+                    slot.state = ChunkedFrame::State::DROPPED;
+                    ++stats_.expired;
+                }
+            }
+        }
+
+        const ReassemblyStats& stats() const
+        {
+            return stats_;
+        }
+
+    private:
+
+        //!Chunks of a frame of frame_size bytes, one for an empty frame
+        uint64_t chunks_of(
+                uint64_t frame_size) const
+        {
+            return frame_size > 0 ? (frame_size - 1) / chunk_size_ + 1 : 1;
+        }
+
+        ChunkedFrame* find(
+                uint32_t stream_id,
+                uint32_t index)
+        {
+            for (ChunkedFrame& slot : slots_)
+            {
+                if (slot.state != ChunkedFrame::State::FREE && slot.stream_id == stream_id && slot.index == index)
+                {
+                    return &slot;
+                }
+            }
+            return nullptr;
+        }
+
+        //!Claim a slot for the frame of chunk: a free one, else the oldest finished one, else the oldest partial one
+        ChunkedFrame& start(
+                const MinimalChunk& chunk,
+                uint64_t now_ns)
+        {
+            ChunkedFrame* victim = nullptr;
+            for (ChunkedFrame& slot : slots_)
+            {
+                if (slot.state == ChunkedFrame::State::FREE)
+                {
+                    victim = &slot;
+                    break;
+                }
+                if (victim == nullptr || rank(slot) < rank(*victim) ||
+                        (rank(slot) == rank(*victim) && slot.first_ns < victim->first_ns))
+                {
+                    victim = &slot;
+                }
+            }
+            if (victim->state == ChunkedFrame::State::PARTIAL)
+            {
+                ++stats_.evicted;
+            }
+
+            ChunkedFrame& frame = *victim;
+            frame.state = ChunkedFrame::State::PARTIAL;
+            frame.stream_id = chunk.stream_id();
+            frame.index = chunk.index();
+            frame.time_stamp = chunk.time_stamp();
+            frame.raw_size = chunk.raw_size();
+            frame.codec = chunk.codec();
+            // Only grows past the reserved capacity for frames larger than announced, up to max_frame_size_
+            frame.data.resize(chunk.frame_size());
+            frame.received.assign(chunk.chunk_count(), 0);
+            frame.chunks_received = 0;
+            frame.first_ns = now_ns;
+            return frame;
+        }
+
+        //!Finished slots are reused before partial ones
+        static int rank(
+                const ChunkedFrame& slot)
+        {
+            return slot.state == ChunkedFrame::State::PARTIAL ? 1 : 0;
+        }
+
+        std::vector<ChunkedFrame> slots_;
+        uint32_t chunk_size_;
+        uint32_t max_frame_size_;
+        uint64_t deadline_ns_;
+        ReassemblyStats stats_;
+};
+
+#endif // FRAME_REASSEMBLER_HPP
@@ -0,0 +1,230 @@
+// Frame sources for the Minimal publisher
+
+#ifndef FRAME_SOURCE_HPP
+#define FRAME_SOURCE_HPP
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// A frame handed out by a source. data stays valid until the source is destroyed.
+struct Frame
+{
+    const uint8_t* data;
+    size_t size;
+    uint32_t sequence;      // Position of the frame in the source, restarts when looping
+};
+
+class FrameSource
+{
+    public:
+        virtual ~FrameSource()
+        {
+        }
+
+        //!Next frame to publish, false when the source is exhausted
+        virtual bool next(
+                Frame& frame) = 0;
+
+        //!Size of the largest frame
+        virtual size_t max_size() const = 0;
+
+        virtual size_t frame_count() const = 0;
+};
+
+// Serves frames straight from read-only mappings, so publishing a frame costs
+// no read() syscall and no intermediate buffer. The path is either
+//  - a directory: every regular file is one frame, played in name order, or
+//  - a file: split into frames of frame_size bytes (a raw recorded stream),
+//    or a single frame when frame_size is 0.
+// The kernel is told the access is sequential and the next prefetch frames are
+// requested ahead of time with MADV_WILLNEED, so replay at full rate does not
+// stall on page faults.
+class MappedFrameSource : public FrameSource
+{
+    public:
+        MappedFrameSource(
+                bool loop = true,
+                uint32_t prefetch = 2)
+            : loop_(loop)
+            , prefetch_(prefetch)
+            , position_(0)
+            , max_size_(0)
+        {
+        }
+
+        ~MappedFrameSource() override
+        {
+            for (const Mapping& mapping : mappings_)
+            {
+                munmap(mapping.base, mapping.length);
+            }
+        }
+
+        //!Map path (a file or a directory of frames)
+        bool open(
+                const std::string& path,
+                size_t frame_size = 0)
+        {
+            struct stat info;
+            if (stat(path.c_str(), &info) != 0)
+            {
+                std::cout << "Error opening frame source " << path << std::endl;
+                return false;
+            }
+
+            if (S_ISDIR(info.st_mode))
+            {
+                std::vector<std::string> names;
+                DIR* dir = opendir(path.c_str());
+                if (dir == nullptr)
+                {
+                    std::cout << "Error opening frame directory " << path << std::endl;
+                    return false;
+                }
+                while (dirent* entry = readdir(dir))
+                {
+                    if (entry->d_name[0] != '.')
+                    {
+                        names.push_back(entry->d_name);
+                    }
+                }
+                closedir(dir);
+                std::sort(names.begin(), names.end());
+                for (const std::string& name : names)
+                {
+                    std::string file = path + "/" + name;
+                    if (stat(file.c_str(), &info) == 0 && S_ISREG(info.st_mode) && !map_file(file, 0))
+                    {
+                        return false;
+                    }
+                }
+            }
+            else if (!map_file(path, frame_size))
+            {
+                return false;
+            }
+
+            if (frames_.empty())
+            {
+                std::cout << "Frame source " << path << " has no frames" << std::endl;
+                return false;
+            }
+            prefetch(0, prefetch_);
+            return true;
+        }
+
+        bool next(
+                Frame& frame) override
+        {
+            if (position_ == frames_.size())
+            {
+                if (!loop_ || frames_.empty())
+                {
+                    return false;
+                }
+                position_ = 0;
+            }
+            frame = frames_[position_];
+            ++position_;
+            // Frames up to position_ + prefetch_ - 2 were already requested
+            if (prefetch_ > 0)
+            {
+                prefetch(position_ + prefetch_ - 1, 1);
+            }
+            return true;
+        }
+
+        size_t max_size() const override
+        {
+            return max_size_;
+        }
+
+        size_t frame_count() const override
+        {
+            return frames_.size();
+        }
+
+    private:
+
+        struct Mapping
+        {
+            void* base;
+            size_t length;
+        };
+
+        bool map_file(
+                const std::string& path,
+                size_t frame_size)
+        {
+            int fd = ::open(path.c_str(), O_RDONLY);
+            if (fd < 0)
+            {
+                std::cout << "Error opening " << path << std::endl;
+                return false;
+            }
+            struct stat info;
+            if (fstat(fd, &info) != 0 || info.st_size == 0)
+            {
+                // Empty files are skipped, mmap refuses zero lengths
+                close(fd);
+                return true;
+            }
+
+            size_t length = static_cast<size_t>(info.st_size);
+            void* base = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+            close(fd);
+            if (base == MAP_FAILED)
+            {
+                std::cout << "Error mapping " << path << ": " << std::strerror(errno) << std::endl;
+                return false;
+            }
+            madvise(base, length, MADV_SEQUENTIAL);
+            mappings_.push_back({base, length});
+
+            const uint8_t* data = static_cast<const uint8_t*>(base);
+            size_t step = frame_size == 0 ? length : frame_size;
+            for (size_t offset = 0; offset < length; offset += step)
+            {
+                // A trailing partial frame is kept, a recording may not end on a frame boundary
+                size_t size = std::min(step, length - offset);
+                frames_.push_back({data + offset, size, static_cast<uint32_t>(frames_.size())});
+                max_size_ = std::max(max_size_, size);
+            }
+            return true;
+        }
+
+        //!Ask the kernel to fault in count frames starting at first
+        void prefetch(
+                size_t first,
+                size_t count)
+        {
+            static const uintptr_t page = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+            for (size_t i = 0; i < count && !frames_.empty(); ++i)
+            {
+                const Frame& frame = frames_[(first + i) % frames_.size()];
+                uintptr_t start = reinterpret_cast<uintptr_t>(frame.data) & ~(page - 1);
+                uintptr_t end = reinterpret_cast<uintptr_t>(frame.data) + frame.size;
+                madvise(reinterpret_cast<void*>(start), end - start, MADV_WILLNEED);
+            }
+        }
+
+        bool loop_;
+        uint32_t prefetch_;
+        size_t position_;
+        size_t max_size_;
+        std::vector<Mapping> mappings_;
+        std::vector<Frame> frames_;
+};
+
+#endif // FRAME_SOURCE_HPP
@@ -0,0 +1,151 @@
+// Fixed-memory log-linear latency histogram
+
+#ifndef LATENCY_HISTOGRAM_HPP
+#define LATENCY_HISTOGRAM_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+// HDR-style histogram of nanosecond values. Values below 2^SUB_BUCKET_BITS are
+// counted exactly, above that every power of two is split in 2^(SUB_BUCKET_BITS-1)
+// linear sub-buckets, which keeps the relative error under 1/64 (better than
+// 1 us up to 64 us) over the whole uint64 range with ~30 KB of counters.
+class LatencyHistogram
+{
+    public:
+        static const int SUB_BUCKET_BITS = 7;
+        static const uint64_t SUB_BUCKET_COUNT = 1ULL << SUB_BUCKET_BITS;
+        static const uint64_t SUB_BUCKET_HALF = SUB_BUCKET_COUNT / 2;
+        static const size_t BUCKET_COUNT = (64 - SUB_BUCKET_BITS + 1) * SUB_BUCKET_HALF + SUB_BUCKET_HALF;
+
+        LatencyHistogram()
+        {
+            reset();
+        }
+
+        void reset()
+        {
+            std::memset(counts_, 0, sizeof(counts_));
+            total_ = 0;
+            sum_ = 0;
+            min_ = std::numeric_limits<uint64_t>::max();
+            max_ = 0;
+        }
+
+        void record(
+                uint64_t value)
+        {
+            ++counts_[bucket_index(value)];
+            ++total_;
+            sum_ += value;
+            if (value < min_)
+            {
+                min_ = value;
+            }
+            if (value > max_)
+            {
+                max_ = value;
+            }
+        }
+
+        //!Add every count of other into this histogram
+        void merge(
+                const LatencyHistogram& other)
+        {
+            for (size_t i = 0; i < BUCKET_COUNT; ++i)
+            {
+                counts_[i] += other.counts_[i];
+            }
+            total_ += other.total_;
+            sum_ += other.sum_;
+            if (other.min_ < min_)
+            {
+                min_ = other.min_;
+            }
+            if (other.max_ > max_)
+            {
+                max_ = other.max_;
+            }
+        }
+
+        //!Smallest recorded value v such that percentile % of the values are <= v (within bucket precision)
+        uint64_t value_at_percentile(
+                double percentile) const
+        {
+            if (total_ == 0)
+            {
+                return 0;
+            }
+            uint64_t target = static_cast<uint64_t>(percentile / 100.0 * total_ + 0.5);
+            if (target < 1)
+            {
+                target = 1;
+            }
+            uint64_t seen = 0;
+            for (size_t i = 0; i < BUCKET_COUNT; ++i)
+            {
+                seen += counts_[i];
+                if (seen >= target)
+                {
+                    uint64_t value = highest_equivalent_value(i);
+                    return value > max_ ? max_ : value;
+                }
+            }
+            return max_;
+        }
+
+        uint64_t count() const
+        {
+            return total_;
+        }
+
+        uint64_t min() const
+        {
+            return total_ == 0 ? 0 : min_;
+        }
+
+        uint64_t max() const
+        {
+            return max_;
+        }
+
+        double mean() const
+        {
+            return total_ == 0 ? 0.0 : static_cast<double>(sum_) / total_;
+        }
+
+    private:
+
+        static size_t bucket_index(
+                uint64_t value)
+        {
+            if (value < SUB_BUCKET_COUNT)
+            {
+                return static_cast<size_t>(value);
+            }
+            int msb = 63 - __builtin_clzll(value);
+            int shift = msb - (SUB_BUCKET_BITS - 1);
+            return static_cast<size_t>(shift) * SUB_BUCKET_HALF + static_cast<size_t>(value >> shift);
+        }
+
+        static uint64_t highest_equivalent_value(
+                size_t index)
+        {
+            if (index < SUB_BUCKET_COUNT)
+            {
+                return index;
+            }
+            uint64_t shift = index / SUB_BUCKET_HALF - 1;
+            uint64_t sub_bucket = index % SUB_BUCKET_HALF + SUB_BUCKET_HALF;
+            return ((sub_bucket + 1) << shift) - 1;
+        }
+
+        uint64_t counts_[BUCKET_COUNT];
+        uint64_t total_;
+        uint64_t sum_;
+        uint64_t min_;
+        uint64_t max_;
+};
+
+#endif // LATENCY_HISTOGRAM_HPP
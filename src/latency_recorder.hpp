@@ -0,0 +1,168 @@
+// Asynchronous latency recorder for the Minimal subscriber
+
+#ifndef LATENCY_RECORDER_HPP
+#define LATENCY_RECORDER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "spsc_ring.hpp"
+
+// One record per received sample. The binary file is a plain array of these
+// structs in host byte order.
+struct LatencyRecord
+{
+    uint64_t receive_ns;
+    uint64_t send_ns;
+    uint32_t index;
+    uint32_t size;
+};
+
+// record() only pushes into an in-memory ring, a background thread drains it
+// and appends large batches to the binary file. The receive path therefore
+// never touches the filesystem. Records are dropped (and counted) if the
+// writer falls behind and the ring fills up.
+class LatencyRecorder
+{
+    public:
+        LatencyRecorder(
+                size_t capacity = 1 << 16,
+                size_t batch = 4096)
+            : ring_(capacity)
+            , batch_(batch)
+            , file_(nullptr)
+            , running_(false)
+            , recorded_(0)
+            , dropped_(0)
+        {
+        }
+
+        ~LatencyRecorder()
+        {
+            stop();
+        }
+
+        //!Open the binary output and start the writer thread
+        bool start(
+                const std::string& path)
+        {
+            path_ = path;
+            file_ = std::fopen(path.c_str(), "wb");
+            if (file_ == nullptr)
+            {
+                return false;
+            }
+            running_ = true;
+            writer_ = std::thread(&LatencyRecorder::drain, this);
+            return true;
+        }
+
+        //!Queue a record. Lock-free, called from the receive path
+        void record(
+                const LatencyRecord& record)
+        {
+            if (ring_.push(record))
+            {
+                recorded_.fetch_add(1, std::memory_order_relaxed);
+            }
+            else
+            {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        //!Flush every queued record, stop the writer thread and close the file
+        void stop()
+        {
+            if (!running_.exchange(false))
+            {
+                return;
+            }
+            writer_.join();
+            std::fclose(file_);
+            file_ = nullptr;
+        }
+
+        //!Convert the binary file written so far into CSV (receive_ns,send_ns,index,size)
+        bool export_csv(
+                const std::string& csv_path) const
+        {
+            FILE* in = std::fopen(path_.c_str(), "rb");
+            if (in == nullptr)
+            {
+                return false;
+            }
+            FILE* out = std::fopen(csv_path.c_str(), "w");
+            if (out == nullptr)
+            {
+                std::fclose(in);
+                return false;
+            }
+
+            std::fprintf(out, "receive_ns,send_ns,index,size\n");
+            std::vector<LatencyRecord> batch(batch_);
+            size_t read;
+            while ((read = std::fread(batch.data(), sizeof(LatencyRecord), batch.size(), in)) > 0)
+            {
+                for (size_t i = 0; i < read; ++i)
+                {
+                    std::fprintf(out, "%llu,%llu,%u,%u\n",
+                            static_cast<unsigned long long>(batch[i].receive_ns),
+                            static_cast<unsigned long long>(batch[i].send_ns),
+                            batch[i].index, batch[i].size);
+                }
+            }
+            std::fclose(in);
+            std::fclose(out);
+            return true;
+        }
+
+        uint64_t recorded() const
+        {
+            return recorded_.load(std::memory_order_relaxed);
+        }
+
+        uint64_t dropped() const
+        {
+            return dropped_.load(std::memory_order_relaxed);
+        }
+
+    private:
+
+        //!Writer thread: polls the ring so the producer never needs to signal it
+        void drain()
+        {
+            std::vector<LatencyRecord> batch(batch_);
+            bool keep_running = true;
+            while (keep_running)
+            {
+                keep_running = running_.load();
+                size_t count;
+                while ((count = ring_.pop_bulk(batch.data(), batch.size())) > 0)
+                {
+                    std::fwrite(batch.data(), sizeof(LatencyRecord), count, file_);
+                }
+                if (keep_running)
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                }
+            }
+            std::fflush(file_);
+        }
+
+        SpscRing<LatencyRecord> ring_;
+        size_t batch_;
+        std::string path_;
+        FILE* file_;
+        std::thread writer_;
+        std::atomic_bool running_;
+        std::atomic<uint64_t> recorded_;
+        std::atomic<uint64_t> dropped_;
+};
+
+#endif // LATENCY_RECORDER_HPP
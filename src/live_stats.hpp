@@ -0,0 +1,246 @@
+// Live statistics of long runs: one rolling window per period, published on MinimalStatsTopic
+
+#ifndef LIVE_STATS_HPP
+#define LIVE_STATS_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <unistd.h>
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/publisher/qos/DataWriterQos.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+
+#include "MinimalPubSubTypes.hpp"
+#include "latency_histogram.hpp"
+#include "minimal_clock.hpp"
+#include "receive_stats.hpp"
+
+const char* const MINIMAL_STATS_TOPIC = "MinimalStatsTopic";
+
+// Frames written by one publisher stream over a period
+struct SendCounts
+{
+    LatencyHistogram write_ns;
+    uint64_t samples = 0;
+    uint64_t bytes = 0;
+    uint64_t lost = 0;
+
+    void reset()
+    {
+        write_ns.reset();
+        samples = 0;
+        bytes = 0;
+        lost = 0;
+    }
+
+    void merge(
+            const SendCounts& other)
+    {
+        write_ns.merge(other.write_ns);
+        samples += other.samples;
+        bytes += other.bytes;
+        lost += other.lost;
+    }
+
+    //!Summary in the subscriber's terms, the write() durations standing for the latencies
+    ReceiveReport report(
+            double seconds) const
+    {
+        ReceiveReport report;
+        report.samples = samples;
+        report.lost = lost;
+        report.bytes = bytes;
+        report.seconds = seconds;
+        report.min_ns = write_ns.min();
+        report.p50_ns = write_ns.value_at_percentile(50.0);
+        report.p90_ns = write_ns.value_at_percentile(90.0);
+        report.p99_ns = write_ns.value_at_percentile(99.0);
+        report.p999_ns = write_ns.value_at_percentile(99.9);
+        report.max_ns = write_ns.max();
+        return report;
+    }
+};
+
+// Double buffered counters of one stream: the stream thread adds to the active
+// buffer, the stats thread swaps them once per period and reads the idle one
+// without holding the lock, so a write never waits for a histogram merge.
+class SendWindow
+{
+    public:
+        void on_write(
+                uint64_t write_ns,
+                uint64_t bytes)
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            SendCounts& counts = buffers_[active_];
+            counts.write_ns.record(write_ns);
+            ++counts.samples;
+            counts.bytes += bytes;
+        }
+
+        void on_lost()
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            ++buffers_[active_].lost;
+        }
+
+        //!Add the counts since the previous drain to total and start a new period (stats thread only)
+        void drain_into(
+                SendCounts& total)
+        {
+            int idle;
+            {
+                std::lock_guard<std::mutex> guard(mutex_);
+                idle = active_;
+                active_ = 1 - active_;
+            }
+            total.merge(buffers_[idle]);
+            buffers_[idle].reset();
+        }
+
+    private:
+        std::mutex mutex_;
+        SendCounts buffers_[2];
+        int active_ = 0;
+};
+
+// Writer of the MinimalStats samples of this process, keyed by its process id,
+// each one also printed as a single console line. Reliable, transient local
+// and KEEP_LAST 1: a monitor joining late gets the last period at once.
+class LiveStatsPublisher
+{
+    public:
+        static const uint8_t PUBLISHER = 0;
+        static const uint8_t SUBSCRIBER = 1;
+
+        LiveStatsPublisher(
+                uint8_t role,
+                ClockDomain clock)
+            : type_(new MinimalStatsPubSubType())
+            , clock_(clock)
+            , participant_(nullptr)
+            , topic_(nullptr)
+            , publisher_(nullptr)
+            , writer_(nullptr)
+            , failures_(0)
+        {
+            sample_.source(static_cast<uint32_t>(getpid()));
+            sample_.role(role);
+        }
+
+        //!Create the topic, publisher and writer of the stats in participant
+        bool init(
+                eprosima::fastdds::dds::DomainParticipant* participant)
+        {
+            using namespace eprosima::fastdds::dds;
+
+            participant_ = participant;
+            type_.register_type(participant_);
+            topic_ = participant_->create_topic(MINIMAL_STATS_TOPIC, type_.get_type_name(), TOPIC_QOS_DEFAULT);
+            if (topic_ == nullptr)
+            {
+                return false;
+            }
+            publisher_ = participant_->create_publisher(PUBLISHER_QOS_DEFAULT, nullptr);
+            if (publisher_ == nullptr)
+            {
+                return false;
+            }
+
+            DataWriterQos qos = DATAWRITER_QOS_DEFAULT;
+            publisher_->get_default_datawriter_qos(qos);
+            qos.reliability().kind = ReliabilityQosPolicyKind::RELIABLE_RELIABILITY_QOS;
+            qos.durability().kind = DurabilityQosPolicyKind::TRANSIENT_LOCAL_DURABILITY_QOS;
+            qos.history().kind = HistoryQosPolicyKind::KEEP_LAST_HISTORY_QOS;
+            qos.history().depth = 1;
+            writer_ = publisher_->create_datawriter(topic_, qos, nullptr);
+            if (writer_ == nullptr)
+            {
+                return false;
+            }
+            std::cout << "Publishing live stats on " << MINIMAL_STATS_TOPIC << " as source " << sample_.source()
+                      << std::endl;
+            return true;
+        }
+
+        //!Delete the entities of init(), before the participant
+        void destroy()
+        {
+            if (writer_ != nullptr)
+            {
+                publisher_->delete_datawriter(writer_);
+                writer_ = nullptr;
+            }
+            if (publisher_ != nullptr)
+            {
+                participant_->delete_publisher(publisher_);
+                publisher_ = nullptr;
+            }
+            if (topic_ != nullptr)
+            {
+                participant_->delete_topic(topic_);
+                topic_ = nullptr;
+            }
+        }
+
+        //!Publish and print the period summarized by report
+        void publish(
+                const ReceiveReport& report,
+                uint32_t matched)
+        {
+            sample_.matched(matched);
+            sample_.time_stamp(now_ns(clock_));
+            sample_.window_s(report.seconds);
+            sample_.samples(report.samples);
+            sample_.total_samples(sample_.total_samples() + report.samples);
+            sample_.lost(report.lost);
+            sample_.total_lost(sample_.total_lost() + report.lost);
+            sample_.samples_per_second(report.samples_per_second());
+            sample_.mbytes_per_second(report.mbytes_per_second());
+            sample_.p50_ns(report.p50_ns);
+            sample_.p90_ns(report.p90_ns);
+            sample_.p99_ns(report.p99_ns);
+            sample_.max_ns(report.max_ns);
+            if (writer_->write(&sample_) != eprosima::fastdds::dds::RETCODE_OK && failures_++ == 0)
+            {
+                std::cout << "Cannot publish on " << MINIMAL_STATS_TOPIC << std::endl;
+            }
+            std::cout << "[stats] " << to_string(sample_) << std::endl;
+        }
+
+        //!One line summary of a MinimalStats sample, latencies in microseconds
+        static std::string to_string(
+                const MinimalStats& stats)
+        {
+            const bool subscriber = stats.role() == SUBSCRIBER;
+            char line[320];
+            std::snprintf(line, sizeof(line),
+                    "%s %u, %u matched, %.1f s: %llu samples (%.1f samples/s, %.2f MB/s) lost %llu, "
+                    "total %llu lost %llu, %s us p50/p90/p99/max: %.1f/%.1f/%.1f/%.1f",
+                    subscriber ? "subscriber" : "publisher", stats.source(), stats.matched(), stats.window_s(),
+                    static_cast<unsigned long long>(stats.samples()), stats.samples_per_second(),
+                    stats.mbytes_per_second(), static_cast<unsigned long long>(stats.lost()),
+                    static_cast<unsigned long long>(stats.total_samples()),
+                    static_cast<unsigned long long>(stats.total_lost()), subscriber ? "latency" : "write()",
+                    stats.p50_ns() / 1e3, stats.p90_ns() / 1e3, stats.p99_ns() / 1e3, stats.max_ns() / 1e3);
+            return line;
+        }
+
+    private:
+        eprosima::fastdds::dds::TypeSupport type_;
+        ClockDomain clock_;
+        eprosima::fastdds::dds::DomainParticipant* participant_;
+        eprosima::fastdds::dds::Topic* topic_;
+        eprosima::fastdds::dds::Publisher* publisher_;
+        eprosima::fastdds::dds::DataWriter* writer_;
+        MinimalStats sample_;
+        uint64_t failures_;
+};
+
+#endif // LIVE_STATS_HPP
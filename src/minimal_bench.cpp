@@ -0,0 +1,907 @@
+// Parameter sweep driver for the Minimal publisher/subscriber pair
+// Runs every combination of payload size, transport, reliability, history depth,
+// rate, reader count, compression, chunk size, publish mode, QoS profile, receive engine, take batch and
+// round-trip mode on the local host and collects the subscriber (and publisher) reports in JSON and CSV.
+
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "Minimal.hpp"    // MINIMAL_FRAME_CAPACITY
+
+struct BenchConfig
+{
+    std::vector<uint32_t> sizes = {1024, 16 * 1024, 64 * 1024, 256 * 1024, 1024 * 1024,
+                                   4 * 1024 * 1024, 8 * 1024 * 1024, 32 * 1024 * 1024};
+    std::vector<std::string> transports = {"shm", "datasharing", "udp", "large"};
+    std::vector<std::string> reliabilities = {"reliable"};
+    std::vector<uint32_t> history_depths = {1};
+    std::vector<double> rates = {0};    // 0: saturate
+    std::vector<uint32_t> readers = {1};    // More than one runs MultipleSubs
+    std::vector<std::string> compressions = {"none"};
+    std::vector<uint32_t> chunk_sizes = {0};    // 0: frames sent whole
+    std::vector<std::string> publish_modes = {"sync"};
+    std::vector<std::string> qos_profiles = {"none"};  // none: --reliability and --history-depths apply
+    std::vector<std::string> receive_engines = {"listener"};
+    std::vector<uint32_t> take_batches = {0};   // 0: one sample per take
+    std::vector<std::string> ping_modes = {"off"};  // full/header: round trips, echoing the payload or not
+    uint32_t ping_warmup = 10;
+    std::string flow_scheduler = "fifo";        // Flow controller of the async points
+    std::string flow_max_bytes = "0";
+    std::string flow_period_ms = "100";
+    uint32_t samples = 200;
+    uint32_t domain = 0;
+    double timeout_s = 10;              // Subscriber gives up after this long without a sample
+    double point_limit_s = 300;         // Hard limit for one point
+    std::string bin_dir;                // Empty: directory of this executable
+    std::string json_path = "bench.json";
+    std::string csv_path = "bench.csv";
+    std::string log_path = "bench.log";
+};
+
+// One test point and its outcome
+struct BenchPoint
+{
+    std::string transport;
+    uint32_t size;
+    std::string reliability;
+    uint32_t history_depth;
+    double rate_hz;
+    uint32_t readers;
+    std::string compression;
+    uint32_t chunk_size;
+    std::string publish_mode;
+    std::string qos_profile;
+    std::string receive;
+    uint32_t take_batch;
+    std::string ping;
+
+    std::string status;                 // ok, timeout, failed or skipped
+    double received = 0;
+    double lost = 0;
+    double seconds = 0;
+    double samples_per_second = 0;
+    double mbytes_per_second = 0;
+    double min_ns = 0;
+    double p50_ns = 0;
+    double p90_ns = 0;
+    double p99_ns = 0;
+    double p999_ns = 0;
+    double max_ns = 0;
+    double compression_ratio = 1;       // Raw bytes per byte on the wire
+    double encode_us = 0;               // Per frame, publisher side
+    double encode_cpu_us = 0;           // Summed over the compression threads
+    double decode_us = 0;
+    double decode_cpu_us = 0;
+    double frames_dropped = 0;          // Chunk mode: partial frames expired or evicted by the subscriber
+    double mean_batch = 0;              // Samples per take() on the subscriber, 0 with take_next_sample()
+    double write_mean_ns = 0;           // Publisher write() call, all streams
+    double write_p50_ns = 0;
+    double write_p99_ns = 0;
+    double write_max_ns = 0;
+    double loss_rate = 0;               // Subscriber sequence tracking: indexes never received
+    double max_burst = 0;               // Longest run of lost indexes
+    double reordered = 0;
+    double duplicates = 0;
+    double rtt_p50_ns = 0;              // Ping points: round trip measured by the publisher
+    double rtt_p99_ns = 0;
+    double rtt_lost = 0;
+    double pub_rss_kb = 0;              // Peak resident memory of each process
+    double sub_rss_kb = 0;
+};
+
+//!Parse sizes with an optional K/M suffix (powers of 1024)
+static bool parse_size(
+        const std::string& text,
+        uint32_t& size)
+{
+    char* end = nullptr;
+    double value = std::strtod(text.c_str(), &end);
+    if (end == text.c_str())
+    {
+        return false;
+    }
+    if (*end == 'K' || *end == 'k')
+    {
+        value *= 1024;
+        ++end;
+    }
+    else if (*end == 'M' || *end == 'm')
+    {
+        value *= 1024 * 1024;
+        ++end;
+    }
+    if (*end != '\0' || value < 1 || value > 0xFFFFFFFFu)
+    {
+        return false;
+    }
+    size = static_cast<uint32_t>(value);
+    return true;
+}
+
+//!Parse a whole number in [min, max], false for anything else (strtoul would read garbage as 0)
+static bool parse_count(
+        const std::string& text,
+        uint32_t& value,
+        uint32_t min = 0,
+        uint32_t max = 0xFFFFFFFFu)
+{
+    char* end = nullptr;
+    errno = 0;
+    long long parsed = std::strtoll(text.c_str(), &end, 10);
+    if (end == text.c_str() || *end != '\0' || errno == ERANGE || parsed < min || parsed > max)
+    {
+        return false;
+    }
+    value = static_cast<uint32_t>(parsed);
+    return true;
+}
+
+//!Parse a finite number of min or more
+static bool parse_number(
+        const std::string& text,
+        double& value,
+        double min)
+{
+    char* end = nullptr;
+    double parsed = std::strtod(text.c_str(), &end);
+    if (end == text.c_str() || *end != '\0' || !(parsed >= min) || !std::isfinite(parsed))
+    {
+        return false;
+    }
+    value = parsed;
+    return true;
+}
+
+static std::vector<std::string> split(
+        const std::string& text)
+{
+    std::vector<std::string> items;
+    std::istringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ','))
+    {
+        if (!item.empty())
+        {
+            items.push_back(item);
+        }
+    }
+    return items;
+}
+
+static void print_usage(
+        const char* program)
+{
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --sizes list            Payload sizes, K/M suffixes allowed (1K,16K,64K,256K,1M,4M,8M,32M)\n"
+              << "  --transports list       shm,datasharing,udp,large (all)\n"
+              << "  --reliability list      reliable,best-effort (reliable)\n"
+              << "  --history-depths list   KEEP_LAST depths (1)\n"
+              << "  --rates list            Publication rates in Hz, 0 saturates (0)\n"
+              << "  --readers list          Readers per point, e.g. 1,2,4,8,16,32 (1)\n"
+              << "  --compressions list     none,lz4,zstd,auto (none)\n"
+              << "  --chunk-sizes list      Send frames as chunks of these sizes, 0 sends them whole (0)\n"
+              << "  --publish-modes list    sync,async (sync)\n"
+              << "  --qos-profiles list     none,low-latency,reliable-bounded,lossless; profiles replace the\n"
+              << "                          reliability and history depth dimensions (none)\n"
+              << "  --receive-modes list    listener,waitset,poll,hybrid (listener)\n"
+              << "  --take-batches list     Samples per take() on the subscriber, 0 takes one at a time (0)\n"
+              << "  --ping-modes list       off,full,header: round trips echoed with or without payload (off)\n"
+              << "  --ping-warmup n         Round trips left out of the statistics of ping points (10)\n"
+              << "  --flow-scheduler s  --flow-max-bytes n  --flow-period ms\n"
+              << "                          Flow controller of the async points (fifo, 0: unlimited, 100)\n"
+              << "  --samples n             Samples per point (200)\n"
+              << "  --domain id             DDS domain (0)\n"
+              << "  --timeout seconds       Subscriber idle timeout per point (10)\n"
+              << "  --point-limit seconds   Hard limit per point (300)\n"
+              << "  --bin-dir path          Location of DDSMinimalPublisher/Subscriber (next to this binary)\n"
+              << "  --json path  --csv path  --log path   Outputs (bench.json, bench.csv, bench.log)\n";
+}
+
+static bool parse_bench_options(
+        int argc,
+        char** argv,
+        BenchConfig& config)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string name = argv[i];
+        if (name == "--help" || i + 1 >= argc)
+        {
+            print_usage(argv[0]);
+            return false;
+        }
+        std::string value = argv[++i];
+        bool ok = true;
+        if (name == "--sizes")
+        {
+            config.sizes.clear();
+            for (const std::string& item : split(value))
+            {
+                uint32_t size;
+                ok = ok && parse_size(item, size);
+                config.sizes.push_back(size);
+            }
+            ok = ok && !config.sizes.empty();
+        }
+        else if (name == "--transports")
+        {
+            config.transports = split(value);
+            for (const std::string& transport : config.transports)
+            {
+                ok = ok && (transport == "shm" || transport == "datasharing" ||
+                        transport == "udp" || transport == "large");
+            }
+        }
+        else if (name == "--reliability")
+        {
+            config.reliabilities = split(value);
+            for (const std::string& reliability : config.reliabilities)
+            {
+                ok = ok && (reliability == "reliable" || reliability == "best-effort");
+            }
+        }
+        else if (name == "--history-depths")
+        {
+            config.history_depths.clear();
+            for (const std::string& item : split(value))
+            {
+                uint32_t depth = 0;
+                ok = ok && parse_count(item, depth, 1, 0x7FFFFFFF);
+                config.history_depths.push_back(depth);
+            }
+            ok = ok && !config.history_depths.empty();
+        }
+        else if (name == "--rates")
+        {
+            config.rates.clear();
+            for (const std::string& item : split(value))
+            {
+                double rate = 0;
+                ok = ok && parse_number(item, rate, 0);
+                config.rates.push_back(rate);
+            }
+            ok = ok && !config.rates.empty();
+        }
+        else if (name == "--readers")
+        {
+            config.readers.clear();
+            for (const std::string& item : split(value))
+            {
+                uint32_t readers = 0;
+                ok = ok && parse_count(item, readers, 1);
+                config.readers.push_back(readers);
+            }
+            ok = ok && !config.readers.empty();
+        }
+        else if (name == "--compressions")
+        {
+            config.compressions = split(value);
+            for (const std::string& compression : config.compressions)
+            {
+                ok = ok && (compression == "none" || compression == "lz4" || compression == "zstd" ||
+                        compression == "auto");
+            }
+        }
+        else if (name == "--chunk-sizes")
+        {
+            config.chunk_sizes.clear();
+            for (const std::string& item : split(value))
+            {
+                uint32_t chunk_size = 0;
+                ok = ok && (item == "0" || parse_size(item, chunk_size));
+                config.chunk_sizes.push_back(chunk_size);
+            }
+            ok = ok && !config.chunk_sizes.empty();
+        }
+        else if (name == "--publish-modes")
+        {
+            config.publish_modes = split(value);
+            for (const std::string& mode : config.publish_modes)
+            {
+                ok = ok && (mode == "sync" || mode == "async");
+            }
+        }
+        else if (name == "--qos-profiles")
+        {
+            config.qos_profiles = split(value);
+            for (const std::string& profile : config.qos_profiles)
+            {
+                ok = ok && (profile == "none" || profile == "low-latency" || profile == "reliable-bounded" ||
+                        profile == "lossless");
+            }
+        }
+        else if (name == "--receive-modes")
+        {
+            config.receive_engines = split(value);
+            for (const std::string& engine : config.receive_engines)
+            {
+                ok = ok && (engine == "listener" || engine == "waitset" || engine == "poll" || engine == "hybrid");
+            }
+        }
+        else if (name == "--take-batches")
+        {
+            config.take_batches.clear();
+            for (const std::string& item : split(value))
+            {
+                uint32_t batch = 0;
+                ok = ok && parse_count(item, batch, 0, 0x7FFFFFFF);
+                config.take_batches.push_back(batch);
+            }
+            ok = ok && !config.take_batches.empty();
+        }
+        else if (name == "--ping-modes")
+        {
+            config.ping_modes = split(value);
+            for (const std::string& mode : config.ping_modes)
+            {
+                ok = ok && (mode == "off" || mode == "full" || mode == "header");
+            }
+        }
+        else if (name == "--ping-warmup")
+        {
+            ok = parse_count(value, config.ping_warmup);
+        }
+        else if (name == "--flow-scheduler")
+        {
+            config.flow_scheduler = value;
+            ok = value == "fifo" || value == "round-robin" || value == "high-priority" || value == "reservation";
+        }
+        else if (name == "--flow-max-bytes")
+        {
+            // Passed on as given: checked here so that a bad value fails before the sweep, not at every point
+            uint32_t bytes;
+            config.flow_max_bytes = value;
+            ok = parse_count(value, bytes, 0, 0x7FFFFFFF);
+        }
+        else if (name == "--flow-period")
+        {
+            uint32_t period_ms;
+            config.flow_period_ms = value;
+            ok = parse_count(value, period_ms, 1);
+        }
+        else if (name == "--samples")
+        {
+            ok = parse_count(value, config.samples, 1);
+        }
+        else if (name == "--domain")
+        {
+            ok = parse_count(value, config.domain, 0, 232);
+        }
+        else if (name == "--timeout")
+        {
+            ok = parse_number(value, config.timeout_s, 0);
+        }
+        else if (name == "--point-limit")
+        {
+            ok = parse_number(value, config.point_limit_s, 0) && config.point_limit_s > 0;
+        }
+        else if (name == "--bin-dir")
+        {
+            config.bin_dir = value;
+        }
+        else if (name == "--json")
+        {
+            config.json_path = value;
+        }
+        else if (name == "--csv")
+        {
+            config.csv_path = value;
+        }
+        else if (name == "--log")
+        {
+            config.log_path = value;
+        }
+        else
+        {
+            ok = false;
+        }
+
+        if (!ok)
+        {
+            std::cout << "Invalid option " << name << " " << value << std::endl;
+            print_usage(argv[0]);
+            return false;
+        }
+    }
+    return true;
+}
+
+//!Directory holding this executable, where the publisher and subscriber are built
+static std::string executable_dir()
+{
+    char path[4096];
+    ssize_t length = readlink("/proc/self/exe", path, sizeof(path) - 1);
+    if (length <= 0)
+    {
+        return ".";
+    }
+    path[length] = '\0';
+    std::string dir(path);
+    return dir.substr(0, dir.rfind('/'));
+}
+
+//!Start program with args, its stdout/stderr appended to log_fd
+static pid_t launch(
+        const std::string& program,
+        const std::vector<std::string>& args,
+        int log_fd)
+{
+    pid_t pid = fork();
+    if (pid == 0)
+    {
+        dup2(log_fd, STDOUT_FILENO);
+        dup2(log_fd, STDERR_FILENO);
+        std::vector<char*> argv;
+        argv.push_back(const_cast<char*>(program.c_str()));
+        for (const std::string& arg : args)
+        {
+            argv.push_back(const_cast<char*>(arg.c_str()));
+        }
+        argv.push_back(nullptr);
+        execv(program.c_str(), argv.data());
+        std::perror(program.c_str());
+        _exit(127);
+    }
+    return pid;
+}
+
+//!Wait for pid up to limit_s, then kill it. True if it exited by itself with status 0
+static bool wait_or_kill(
+        pid_t pid,
+        double limit_s,
+        double& max_rss_kb)
+{
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(limit_s));
+    int status = 0;
+    struct rusage usage;
+    std::memset(&usage, 0, sizeof(usage));
+    while (wait4(pid, &status, WNOHANG, &usage) == 0)
+    {
+        if (std::chrono::steady_clock::now() >= deadline)
+        {
+            kill(pid, SIGKILL);
+            wait4(pid, &status, 0, &usage);
+            max_rss_kb = static_cast<double>(usage.ru_maxrss);
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+    max_rss_kb = static_cast<double>(usage.ru_maxrss);
+    return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+//!Value of a numeric member of a flat JSON text, false if it is missing
+static bool json_number(
+        const std::string& json,
+        const std::string& key,
+        double& value)
+{
+    size_t pos = json.find("\"" + key + "\":");
+    if (pos == std::string::npos)
+    {
+        return false;
+    }
+    value = std::strtod(json.c_str() + pos + key.size() + 3, nullptr);
+    return true;
+}
+
+static std::string format_double(
+        double value)
+{
+    char text[64];
+    std::snprintf(text, sizeof(text), "%.3f", value);
+    return text;
+}
+
+//!Cross every point with every value of one dimension
+template<typename T, typename Set>
+static void expand(
+        std::vector<BenchPoint>& points,
+        const std::vector<T>& values,
+        Set set)
+{
+    std::vector<BenchPoint> crossed;
+    crossed.reserve(points.size() * values.size());
+    for (const BenchPoint& point : points)
+    {
+        for (const T& value : values)
+        {
+            crossed.push_back(point);
+            set(crossed.back(), value);
+        }
+    }
+    points.swap(crossed);
+}
+
+//!Run one point: subscriber first, then the publisher, and read back the subscriber report
+static void run_point(
+        const BenchConfig& config,
+        const std::string& bin_dir,
+        int log_fd,
+        BenchPoint& point)
+{
+    // Data sharing needs loans, which are limited to the bounded MinimalFrame (never compressed)
+    bool loan = point.transport == "datasharing";
+    // Chunks are reassembled by the regular subscriber only, and only from Minimal samples.
+    // MultipleSubs only has listeners that drain every sample, and does not echo.
+    if ((loan && (point.size > MINIMAL_FRAME_CAPACITY || point.compression != "none")) ||
+            (point.chunk_size > 0 && (loan || point.readers > 1)) ||
+            ((point.receive != "listener" || point.take_batch > 0 || point.ping != "off") && point.readers > 1))
+    {
+        point.status = "skipped";
+        return;
+    }
+
+    std::vector<std::string> common = {
+        "--domain", std::to_string(config.domain),
+        "--transport", point.transport == "datasharing" ? "shm" : point.transport,
+        "--data-sharing", loan ? "on" : "off",
+        "--size", std::to_string(point.size),
+        "--samples", std::to_string(config.samples),
+        "--chunk-size", std::to_string(point.chunk_size)};
+    if (point.qos_profile != "none")
+    {
+        common.insert(common.end(), {"--qos-profile", point.qos_profile});
+    }
+    else
+    {
+        common.insert(common.end(), {"--reliability", point.reliability,
+                                     "--history-depth", std::to_string(point.history_depth)});
+    }
+    if (loan)
+    {
+        common.push_back("--loan");
+    }
+
+    const std::string report_path = "bench_point.json";
+    const std::string pub_report_path = "bench_point_pub.json";
+    std::remove(report_path.c_str());
+    std::remove(pub_report_path.c_str());
+
+    // A single reader is the regular subscriber, fan-out points use MultipleSubs
+    std::vector<std::string> sub_args = common;
+    sub_args.insert(sub_args.end(), {"--report", report_path, "--timeout", std::to_string(config.timeout_s)});
+    if (point.readers > 1)
+    {
+        sub_args.insert(sub_args.end(), {"--readers", std::to_string(point.readers)});
+    }
+    else
+    {
+        sub_args.insert(sub_args.end(), {"--no-csv", "--report-interval", "0", "--receive", point.receive,
+                                         "--take-batch", std::to_string(point.take_batch)});
+        if (point.ping != "off")
+        {
+            sub_args.push_back(point.ping == "header" ? "--echo-header-only" : "--echo");
+        }
+    }
+    std::vector<std::string> pub_args = common;
+    pub_args.insert(pub_args.end(), {"--compression", point.compression, "--report", pub_report_path,
+                                     "--publish-mode", point.publish_mode});
+    if (point.ping != "off")
+    {
+        pub_args.insert(pub_args.end(), {"--ping", "--warmup", std::to_string(config.ping_warmup)});
+    }
+    if (point.publish_mode == "async")
+    {
+        pub_args.insert(pub_args.end(), {"--flow-scheduler", config.flow_scheduler,
+                                         "--flow-max-bytes", config.flow_max_bytes,
+                                         "--flow-period", config.flow_period_ms});
+    }
+    if (point.rate_hz > 0)
+    {
+        pub_args.insert(pub_args.end(), {"--pacing", "rate", "--rate", std::to_string(point.rate_hz)});
+    }
+    else
+    {
+        pub_args.insert(pub_args.end(), {"--pacing", "saturate"});
+    }
+
+    dprintf(log_fd, "=== %s size %u %s depth %u rate %.1f readers %u compression %s chunk %u %s profile %s "
+            "receive %s batch %u ping %s\n",
+            point.transport.c_str(), point.size, point.reliability.c_str(), point.history_depth, point.rate_hz,
+            point.readers, point.compression.c_str(), point.chunk_size, point.publish_mode.c_str(),
+            point.qos_profile.c_str(), point.receive.c_str(), point.take_batch,
+            point.ping.c_str());
+    pid_t subscriber = launch(bin_dir + (point.readers > 1 ? "/MultipleSubs" : "/DDSMinimalSubscriber"),
+                    sub_args, log_fd);
+    pid_t publisher = launch(bin_dir + "/DDSMinimalPublisher", pub_args, log_fd);
+    if (subscriber < 0 || publisher < 0)
+    {
+        point.status = "failed";
+        return;
+    }
+
+    bool subscriber_ok = wait_or_kill(subscriber, config.point_limit_s, point.sub_rss_kb);
+    // The publisher may still wait for acknowledgments of samples the subscriber gave up on
+    wait_or_kill(publisher, 10, point.pub_rss_kb);
+
+    std::ifstream report_file(report_path);
+    std::stringstream report;
+    report << report_file.rdbuf();
+    std::string json = report.str();
+    double expected = 0;
+    if (!subscriber_ok || !json_number(json, "expected", expected) || !json_number(json, "samples", point.received))
+    {
+        point.status = "failed";
+        return;
+    }
+    point.status = json.find("\"timed_out\": true") != std::string::npos ? "timeout" : "ok";
+    point.lost = expected - point.received;
+    json_number(json, "seconds", point.seconds);
+    json_number(json, "samples_per_second", point.samples_per_second);
+    json_number(json, "mbytes_per_second", point.mbytes_per_second);
+    json_number(json, "min_ns", point.min_ns);
+    json_number(json, "p50_ns", point.p50_ns);
+    json_number(json, "p90_ns", point.p90_ns);
+    json_number(json, "p99_ns", point.p99_ns);
+    json_number(json, "p999_ns", point.p999_ns);
+    json_number(json, "max_ns", point.max_ns);
+    json_number(json, "compression_ratio", point.compression_ratio);
+    json_number(json, "decode_us", point.decode_us);
+    json_number(json, "decode_cpu_us", point.decode_cpu_us);
+    double expired = 0;
+    double evicted = 0;
+    if (json_number(json, "frames_expired", expired) && json_number(json, "frames_evicted", evicted))
+    {
+        point.frames_dropped = expired + evicted;
+    }
+    json_number(json, "mean_batch", point.mean_batch);
+    json_number(json, "loss_rate", point.loss_rate);
+    json_number(json, "max_burst", point.max_burst);
+    json_number(json, "reordered", point.reordered);
+    json_number(json, "duplicates", point.duplicates);
+    std::remove(report_path.c_str());
+
+    std::ifstream pub_report_file(pub_report_path);
+    std::stringstream pub_report;
+    pub_report << pub_report_file.rdbuf();
+    json_number(pub_report.str(), "encode_us", point.encode_us);
+    json_number(pub_report.str(), "encode_cpu_us", point.encode_cpu_us);
+    json_number(pub_report.str(), "write_mean_ns", point.write_mean_ns);
+    json_number(pub_report.str(), "write_p50_ns", point.write_p50_ns);
+    json_number(pub_report.str(), "write_p99_ns", point.write_p99_ns);
+    json_number(pub_report.str(), "write_max_ns", point.write_max_ns);
+    json_number(pub_report.str(), "rtt_p50_ns", point.rtt_p50_ns);
+    json_number(pub_report.str(), "rtt_p99_ns", point.rtt_p99_ns);
+    json_number(pub_report.str(), "rtt_lost", point.rtt_lost);
+    std::remove(pub_report_path.c_str());
+}
+
+static std::string csv_header()
+{
+    return "transport,size,qos_profile,reliability,history_depth,rate_hz,readers,compression,chunk_size,publish_mode,"
+           "receive,take_batch,ping,status,received,lost,seconds,samples_per_second,mbytes_per_second,"
+           "min_ns,p50_ns,p90_ns,p99_ns,p999_ns,max_ns,compression_ratio,encode_us,encode_cpu_us,decode_us,"
+           "decode_cpu_us,frames_dropped,mean_batch,loss_rate,max_burst,reordered,duplicates,"
+           "write_mean_ns,write_p50_ns,write_p99_ns,write_max_ns,rtt_p50_ns,rtt_p99_ns,rtt_lost,pub_rss_kb,sub_rss_kb";
+}
+
+static std::string csv_row(
+        const BenchPoint& p)
+{
+    std::ostringstream row;
+    row << p.transport << "," << p.size << "," << p.qos_profile << "," << p.reliability << "," << p.history_depth << ","
+        << p.rate_hz << "," << p.readers << "," << p.compression << "," << p.chunk_size << ","
+        << p.publish_mode << "," << p.receive << "," << p.take_batch << "," << p.ping << "," << p.status << ","
+        << p.received << "," << p.lost << ","
+        << format_double(p.seconds) << "," << format_double(p.samples_per_second) << ","
+        << format_double(p.mbytes_per_second) << "," << p.min_ns << "," << p.p50_ns << ","
+        << p.p90_ns << "," << p.p99_ns << "," << p.p999_ns << "," << p.max_ns << ","
+        << format_double(p.compression_ratio) << "," << format_double(p.encode_us) << ","
+        << format_double(p.encode_cpu_us) << "," << format_double(p.decode_us) << ","
+        << format_double(p.decode_cpu_us) << "," << p.frames_dropped << "," << format_double(p.mean_batch) << ","
+        << p.loss_rate << "," << p.max_burst << "," << p.reordered << "," << p.duplicates << ","
+        << p.write_mean_ns << "," << p.write_p50_ns << "," << p.write_p99_ns << "," << p.write_max_ns << ","
+        << p.rtt_p50_ns << "," << p.rtt_p99_ns << "," << p.rtt_lost << ","
+        << p.pub_rss_kb << "," << p.sub_rss_kb;
+    return row.str();
+}
+
+static std::string json_object(
+        const BenchPoint& p)
+{
+    std::ostringstream object;
+    object << "{\"transport\": \"" << p.transport << "\", \"size\": " << p.size
+           << ", \"qos_profile\": \"" << p.qos_profile << "\""
+           << ", \"reliability\": \"" << p.reliability << "\", \"history_depth\": " << p.history_depth
+           << ", \"rate_hz\": " << p.rate_hz << ", \"readers\": " << p.readers
+           << ", \"compression\": \"" << p.compression << "\", \"chunk_size\": " << p.chunk_size
+           << ", \"publish_mode\": \"" << p.publish_mode << "\""
+           << ", \"receive\": \"" << p.receive << "\", \"take_batch\": " << p.take_batch
+           << ", \"ping\": \"" << p.ping << "\""
+           << ", \"status\": \"" << p.status << "\""
+           << ", \"received\": " << p.received << ", \"lost\": " << p.lost
+           << ", \"seconds\": " << format_double(p.seconds)
+           << ", \"samples_per_second\": " << format_double(p.samples_per_second)
+           << ", \"mbytes_per_second\": " << format_double(p.mbytes_per_second)
+           << ", \"latency_ns\": {\"min\": " << p.min_ns << ", \"p50\": " << p.p50_ns
+           << ", \"p90\": " << p.p90_ns << ", \"p99\": " << p.p99_ns << ", \"p999\": " << p.p999_ns
+           << ", \"max\": " << p.max_ns << "}"
+           << ", \"compression_ratio\": " << format_double(p.compression_ratio)
+           << ", \"codec_us\": {\"encode\": " << format_double(p.encode_us)
+           << ", \"encode_cpu\": " << format_double(p.encode_cpu_us)
+           << ", \"decode\": " << format_double(p.decode_us)
+           << ", \"decode_cpu\": " << format_double(p.decode_cpu_us) << "}"
+           << ", \"frames_dropped\": " << p.frames_dropped
+           << ", \"mean_batch\": " << format_double(p.mean_batch)
+           << ", \"sequence\": {\"loss_rate\": " << p.loss_rate << ", \"max_burst\": " << p.max_burst
+           << ", \"reordered\": " << p.reordered << ", \"duplicates\": " << p.duplicates << "}"
+           << ", \"write_ns\": {\"mean\": " << p.write_mean_ns << ", \"p50\": " << p.write_p50_ns
+           << ", \"p99\": " << p.write_p99_ns << ", \"max\": " << p.write_max_ns << "}"
+           << ", \"rtt_ns\": {\"p50\": " << p.rtt_p50_ns << ", \"p99\": " << p.rtt_p99_ns
+           << ", \"lost\": " << p.rtt_lost << "}"
+           << ", \"rss_kb\": {\"publisher\": " << p.pub_rss_kb << ", \"subscriber\": " << p.sub_rss_kb << "}}";
+    return object.str();
+}
+
+int main(int argc, char** argv)
+{
+    BenchConfig config;
+    if (!parse_bench_options(argc, argv, config))
+    {
+        return 1;
+    }
+
+    const std::string bin_dir = config.bin_dir.empty() ? executable_dir() : config.bin_dir;
+    int log_fd = open(config.log_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    std::ofstream csv(config.csv_path);
+    if (log_fd < 0 || !csv.is_open())
+    {
+        std::cout << "Error opening the output files" << std::endl;
+        return 1;
+    }
+    csv << csv_header() << std::endl;
+
+    // Every combination, the first dimension varying slowest
+    std::vector<BenchPoint> points(1);
+    expand(points, config.transports, [](BenchPoint& p, const std::string& v)
+            {
+                p.transport = v;
+            });
+    expand(points, config.sizes, [](BenchPoint& p, uint32_t v)
+            {
+                p.size = v;
+            });
+    expand(points, config.qos_profiles, [](BenchPoint& p, const std::string& v)
+            {
+                p.qos_profile = v;
+            });
+    expand(points, config.reliabilities, [](BenchPoint& p, const std::string& v)
+            {
+                p.reliability = v;
+            });
+    expand(points, config.history_depths, [](BenchPoint& p, uint32_t v)
+            {
+                p.history_depth = v;
+            });
+    expand(points, config.rates, [](BenchPoint& p, double v)
+            {
+                p.rate_hz = v;
+            });
+    expand(points, config.readers, [](BenchPoint& p, uint32_t v)
+            {
+                p.readers = v;
+            });
+    expand(points, config.compressions, [](BenchPoint& p, const std::string& v)
+            {
+                p.compression = v;
+            });
+    expand(points, config.chunk_sizes, [](BenchPoint& p, uint32_t v)
+            {
+                p.chunk_size = v;
+            });
+    expand(points, config.publish_modes, [](BenchPoint& p, const std::string& v)
+            {
+                p.publish_mode = v;
+            });
+    expand(points, config.receive_engines, [](BenchPoint& p, const std::string& v)
+            {
+                p.receive = v;
+            });
+    expand(points, config.take_batches, [](BenchPoint& p, uint32_t v)
+            {
+                p.take_batch = v;
+            });
+    expand(points, config.ping_modes, [](BenchPoint& p, const std::string& v)
+            {
+                p.ping = v;
+            });
+    // A profile sets reliability and history itself: keep one point per profile, not one per combination
+    std::vector<BenchPoint> kept;
+    for (BenchPoint& point : points)
+    {
+        if (point.qos_profile == "none")
+        {
+            kept.push_back(point);
+        }
+        else if (point.reliability == config.reliabilities.front() &&
+                point.history_depth == config.history_depths.front())
+        {
+            point.reliability = "profile";
+            point.history_depth = 0;
+            kept.push_back(point);
+        }
+    }
+    points.swap(kept);
+
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        BenchPoint& point = points[i];
+        std::cout << "[" << i + 1 << "/" << points.size() << "] " << point.transport << " " << point.size << " B "
+                  << (point.qos_profile != "none" ? point.qos_profile : point.reliability + " depth " +
+                  std::to_string(point.history_depth)) << " rate "
+                  << (point.rate_hz > 0 ? std::to_string(point.rate_hz) : std::string("saturate"))
+                  << " readers " << point.readers << " compression " << point.compression
+                  << (point.chunk_size > 0 ? " chunk " + std::to_string(point.chunk_size) : std::string()) << " "
+                  << point.publish_mode
+                  << (point.receive != "listener" ? " receive " + point.receive : std::string())
+                  << (point.take_batch > 0 ? " batch " + std::to_string(point.take_batch) : std::string())
+                  << (point.ping != "off" ? " ping " + point.ping : std::string()) << ": "
+                  << std::flush;
+        run_point(config, bin_dir, log_fd, point);
+        std::cout << point.status;
+        if (point.status == "ok" || point.status == "timeout")
+        {
+            std::cout << ", " << format_double(point.mbytes_per_second) << " MB/s, p50 "
+                      << point.p50_ns / 1e3 << " us, p99 " << point.p99_ns / 1e3 << " us, lost " << point.lost;
+            if (point.max_burst > 1 || point.reordered > 0 || point.duplicates > 0)
+            {
+                std::cout << " (max burst " << point.max_burst << ", reordered " << point.reordered << ", duplicates "
+                          << point.duplicates << ")";
+            }
+            if (point.compression != "none")
+            {
+                std::cout << ", ratio " << format_double(point.compression_ratio) << ", encode "
+                          << format_double(point.encode_us) << " us (" << format_double(point.encode_cpu_us)
+                          << " us CPU), decode " << format_double(point.decode_us) << " us";
+            }
+            if (point.chunk_size > 0)
+            {
+                std::cout << ", frames dropped " << point.frames_dropped;
+            }
+            if (point.mean_batch > 0)
+            {
+                std::cout << ", " << format_double(point.mean_batch) << " samples per take";
+            }
+            if (point.ping != "off")
+            {
+                std::cout << ", RTT p50 " << point.rtt_p50_ns / 1e3 << " us, p99 " << point.rtt_p99_ns / 1e3
+                          << " us, lost " << point.rtt_lost;
+            }
+            std::cout << ", write() p50 " << point.write_p50_ns / 1e3 << " us, p99 " << point.write_p99_ns / 1e3
+                      << " us, RSS pub " << point.pub_rss_kb / 1024 << " MB sub " << point.sub_rss_kb / 1024 << " MB";
+        }
+        std::cout << std::endl;
+        // Written as it goes so an interrupted sweep still leaves its results
+        csv << csv_row(point) << std::endl;
+    }
+    close(log_fd);
+
+    std::ofstream json(config.json_path);
+    json << "[\n";
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        json << "  " << json_object(points[i]) << (i + 1 < points.size() ? ",\n" : "\n");
+    }
+    json << "]" << std::endl;
+    std::cout << "Results written to " << config.json_path << " and " << config.csv_path << std::endl;
+    return 0;
+}
@@ -0,0 +1,46 @@
+// Timestamp helpers shared by the Minimal publisher and subscriber
+
+#ifndef MINIMAL_CLOCK_HPP
+#define MINIMAL_CLOCK_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <time.h>
+
+// Clock used to stamp samples on send and to measure them on receive.
+// Both sides must use the same domain: MONOTONIC is only comparable between
+// processes of the same host, REALTIME needs the hosts clocks synchronized.
+enum class ClockDomain
+{
+    MONOTONIC,
+    REALTIME
+};
+
+//!Current time of the given clock domain in nanoseconds
+inline uint64_t now_ns(
+        ClockDomain domain)
+{
+    struct timespec ts;
+    clock_gettime(domain == ClockDomain::REALTIME ? CLOCK_REALTIME : CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ULL + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+//!Parse "monotonic" or "realtime"
+inline bool parse_clock_domain(
+        const char* name,
+        ClockDomain& domain)
+{
+    if (std::strcmp(name, "monotonic") == 0)
+    {
+        domain = ClockDomain::MONOTONIC;
+        return true;
+    }
+    if (std::strcmp(name, "realtime") == 0)
+    {
+        domain = ClockDomain::REALTIME;
+        return true;
+    }
+    return false;
+}
+
+#endif // MINIMAL_CLOCK_HPP
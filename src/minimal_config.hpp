@@ -0,0 +1,1067 @@
+// Runtime configuration shared by the Minimal publisher and subscriber
+
+#ifndef MINIMAL_CONFIG_HPP
+#define MINIMAL_CONFIG_HPP
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <fastdds/dds/domain/qos/DomainParticipantQos.hpp>
+#include <fastdds/dds/publisher/qos/DataWriterQos.hpp>
+#include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
+#include <fastdds/rtps/attributes/BuiltinTransports.hpp>
+#include <fastdds/rtps/flowcontrol/FlowControllerDescriptor.hpp>
+#include <fastdds/rtps/transport/shared_mem/SharedMemTransportDescriptor.hpp>
+#include <fastdds/rtps/transport/UDPv4TransportDescriptor.hpp>
+
+#include "frame_codec.hpp"
+#include "minimal_clock.hpp"
+#include "rate_controller.hpp"
+#include "thread_affinity.hpp"
+
+enum class Transport
+{
+    SHM,        // Shared memory only, plus data sharing unless disabled
+    UDP,        // UDPv4 only
+    LARGE_DATA  // Builtin LARGE_DATA setup (UDP discovery, TCP + SHM data)
+};
+
+// How the subscriber gets its samples
+enum class ReceiveEngine
+{
+    LISTENER,   // on_data_available() on the Fast DDS event thread
+    WAITSET,    // Own thread blocked on a WaitSet with a read condition
+    POLL,       // Own thread spinning on take()
+    HYBRID      // Own thread spinning for spin_us after the last sample, then blocked on the WaitSet
+};
+
+// Highest domain id of the default RTPS port mapping
+const uint32_t MAX_DOMAIN_ID = 232;
+
+// Name of the flow controller the publisher registers for asynchronous writers
+const char* const MINIMAL_FLOW_CONTROLLER = "minimal_flow";
+
+// Asynchronous publication: write() queues the sample and returns, a sender
+// thread of the participant sends it at the pace of the flow controller
+struct FlowControlConfig
+{
+    bool async = false;
+    eprosima::fastdds::rtps::FlowControllerSchedulerPolicy scheduler =
+            eprosima::fastdds::rtps::FlowControllerSchedulerPolicy::FIFO;
+    int32_t max_bytes_per_period = 0;   // 0: unlimited
+    uint64_t period_ms = 100;
+};
+
+// Every option can be given on the command line as --<name> <value> (flags
+// without value) or in a config file as "<name> = <value>" lines. Both
+// executables accept the whole set so one file describes a test point;
+// options that do not apply to a role are ignored.
+struct MinimalConfig
+{
+    // Common
+    uint32_t domain = 0;
+    Transport transport = Transport::SHM;
+    bool data_sharing = true;
+    uint32_t data_size = 1000 * 1000;
+    uint32_t shm_segment_size = 0;      // 0: 10 * data_size
+    uint32_t udp_buffer_size = 0;       // 0: 10 * data_size
+    uint32_t samples = 10;
+    ClockDomain clock = ClockDomain::MONOTONIC;
+    bool loan = false;
+    bool reliable = true;
+    bool transient_local = true;
+    int32_t history_depth = 1;
+    bool keep_all = false;              // KEEP_ALL history: the writer blocks instead of replacing unacknowledged frames
+    int32_t max_samples = 0;            // Frames per instance the histories may hold, all allocated up front; 0: Fast DDS limits
+    uint32_t heartbeat_ms = 0;          // Reliable writer heartbeat period, 0: Fast DDS default
+    int32_t nack_response_ms = -1;      // Writer delay before repairing a NACK, -1: Fast DDS default
+    int32_t heartbeat_response_ms = -1; // Reader delay before answering a heartbeat, -1: Fast DDS default
+    std::string qos_profile;            // Last --qos-profile applied, empty: none
+    CompressionConfig compression;      // Publisher encodes, receivers decode what the codec field says
+    uint32_t chunk_size = 0;            // Send frames as MinimalChunk samples of this size, 0: whole Minimal samples
+    uint32_t frame_deadline_ms = 0;     // Chunk mode: drop a frame still partial this long after its first chunk, 0: never
+    uint32_t max_frame_size = 0;        // Largest frame a receiver reassembles or decodes, 0: 10 * data_size
+    uint32_t live_stats_ms = 0;         // Period of the MinimalStatsTopic samples, 0: off
+    bool verbose = false;               // One console line per frame sent or received
+
+    // Publisher
+    uint32_t streams = 1;               // Streams published in parallel, one writer and thread each
+    bool keyed = false;                 // Streams are stream_id instances of one topic instead of one topic each
+    std::vector<int> cpus;              // Stream i runs on cpus[i % size], empty: not pinned
+    std::string file;                   // Empty: generate ./dummy.bin of data_size bytes, "{stream}" is replaced by the stream id
+    uint32_t frame_size = 0;            // Split file into frames of this size, 0: one frame per file
+    bool loop = true;                   // Restart the source when it runs out of frames
+    uint32_t prefetch = 2;              // Frames requested ahead with MADV_WILLNEED
+    uint32_t pipeline = 0;              // Frame buffers between producer and writer threads, 0: one thread does both
+    FlowControlConfig flow;
+    PacingConfig pacing;
+    bool ping = false;                  // Wait for the subscriber's echo of every frame and measure the round trip
+    uint32_t warmup = 0;                // Ping: first round trips left out of the statistics (part of samples)
+    uint32_t ping_timeout_ms = 1000;    // Ping: an echo not back after this long is counted lost
+
+    // Subscriber
+    uint32_t stream = 0;                // Stream (topic) to subscribe to
+    bool export_csv = true;
+    uint32_t report_interval_ms = 1000;
+    std::string report;                 // Empty: no JSON report
+    double timeout_s = 0;               // 0: wait for every sample
+    ReceiveEngine receive = ReceiveEngine::LISTENER;
+    int receive_cpu = -1;               // CPU of the receive thread (not the listener), -1: not pinned
+    uint32_t spin_us = 50;              // HYBRID: spin this long without a sample before blocking
+    uint32_t take_batch = 0;            // Samples per take(), 0: one take_next_sample() per wakeup (copy mode)
+    bool echo = false;                  // Republish every received frame on the reply topic
+    bool echo_header_only = false;      // Echo: leave img_data out of the replies
+
+    // MultipleSubs
+    uint32_t readers = 1;               // DataReaders on the topic
+    bool shared_participant = false;    // All readers in one participant instead of one each
+
+    uint32_t segment_size() const
+    {
+        return shm_segment_size != 0 ? shm_segment_size : 10 * data_size;
+    }
+
+    //!Topic of a stream: stream 0 (and every stream when keyed) uses the plain topic name
+    std::string topic_name(
+            uint32_t stream_id) const
+    {
+        std::string name = loan ? "MinimalFrameTopic" : chunked() ? "MinimalChunkTopic" : "MinimalTopic";
+        return stream_id == 0 || keyed ? name : name + "_" + std::to_string(stream_id);
+    }
+
+    //!Reply topic of a stream in round-trip mode, always carrying Minimal samples
+    std::string reply_topic_name(
+            uint32_t stream_id) const
+    {
+        return stream_id == 0 || keyed ? "MinimalReplyTopic" : "MinimalReplyTopic_" + std::to_string(stream_id);
+    }
+
+    //!Frames travel as MinimalChunk samples (copy mode only, loans carry whole frames)
+    bool chunked() const
+    {
+        return chunk_size > 0 && !loan;
+    }
+
+    //!Frames announced larger than this are dropped instead of allocated, as large as a shm segment by default
+    uint32_t frame_limit() const
+    {
+        return max_frame_size != 0 ? max_frame_size : 10 * data_size;
+    }
+
+    //!Chunks per frame of data_size bytes, 1 when not chunked
+    uint32_t chunks_per_frame() const
+    {
+        return chunked() && data_size > chunk_size ? (data_size + chunk_size - 1) / chunk_size : 1;
+    }
+
+    //!One line description of the QoS options, e.g. "reliable, volatile, KEEP_LAST 4, 4 frames preallocated"
+    std::string qos_summary() const
+    {
+        std::ostringstream text;
+        if (!qos_profile.empty())
+        {
+            text << qos_profile << ": ";
+        }
+        text << (reliable ? "reliable" : "best-effort") << ", " << (transient_local ? "transient-local" : "volatile");
+        if (keep_all)
+        {
+            text << ", KEEP_ALL";
+        }
+        else
+        {
+            text << ", KEEP_LAST " << history_depth;
+        }
+        if (max_samples > 0)
+        {
+            text << ", " << max_samples << " frames preallocated";
+        }
+        if (reliable && heartbeat_ms > 0)
+        {
+            text << ", heartbeat " << heartbeat_ms << " ms";
+        }
+        return text.str();
+    }
+
+    uint32_t buffer_size() const
+    {
+        return udp_buffer_size != 0 ? udp_buffer_size : 10 * data_size;
+    }
+
+    bool uses_data_sharing() const
+    {
+        return transport == Transport::SHM && data_sharing;
+    }
+};
+
+//!Parse "listener", "waitset", "poll" or "hybrid"
+inline bool parse_receive_engine(
+        const std::string& value,
+        ReceiveEngine& engine)
+{
+    if (value == "listener")
+    {
+        engine = ReceiveEngine::LISTENER;
+    }
+    else if (value == "waitset")
+    {
+        engine = ReceiveEngine::WAITSET;
+    }
+    else if (value == "poll")
+    {
+        engine = ReceiveEngine::POLL;
+    }
+    else if (value == "hybrid")
+    {
+        engine = ReceiveEngine::HYBRID;
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+//!Parse "fifo", "round-robin", "high-priority" or "reservation"
+inline bool parse_flow_scheduler(
+        const std::string& value,
+        eprosima::fastdds::rtps::FlowControllerSchedulerPolicy& scheduler)
+{
+    using eprosima::fastdds::rtps::FlowControllerSchedulerPolicy;
+    if (value == "fifo")
+    {
+        scheduler = FlowControllerSchedulerPolicy::FIFO;
+    }
+    else if (value == "round-robin")
+    {
+        scheduler = FlowControllerSchedulerPolicy::ROUND_ROBIN;
+    }
+    else if (value == "high-priority")
+    {
+        scheduler = FlowControllerSchedulerPolicy::HIGH_PRIORITY;
+    }
+    else if (value == "reservation")
+    {
+        scheduler = FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION;
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+// Named sets of the reliability, durability, history, resource limit and
+// protocol timing options, for the usual trade-offs:
+//   low-latency       best effort, volatile, KEEP_LAST 1: nothing waits for a lost frame
+//   reliable-bounded  reliable, volatile, KEEP_LAST 4 with preallocated histories and fast repairs
+//   lossless          reliable, transient local, KEEP_ALL: the writer blocks rather than drop a frame
+//!Set the fields of profile name, false if unknown (options applied after it override them)
+inline bool apply_qos_profile(
+        MinimalConfig& config,
+        const std::string& name)
+{
+    if (name == "low-latency")
+    {
+        config.reliable = false;
+        config.transient_local = false;
+        config.keep_all = false;
+        config.history_depth = 1;
+        config.max_samples = 1;
+        config.heartbeat_ms = 0;
+        config.nack_response_ms = -1;
+        config.heartbeat_response_ms = -1;
+    }
+    else if (name == "reliable-bounded")
+    {
+        config.reliable = true;
+        config.transient_local = false;
+        config.keep_all = false;
+        config.history_depth = 4;
+        config.max_samples = 4;
+        config.heartbeat_ms = 20;
+        config.nack_response_ms = 0;
+        config.heartbeat_response_ms = 0;
+    }
+    else if (name == "lossless")
+    {
+        config.reliable = true;
+        config.transient_local = true;
+        config.keep_all = true;
+        config.history_depth = 1;
+        config.max_samples = 32;
+        config.heartbeat_ms = 5;
+        config.nack_response_ms = 0;
+        config.heartbeat_response_ms = 0;
+    }
+    else
+    {
+        return false;
+    }
+    config.qos_profile = name;
+    return true;
+}
+
+inline bool parse_bool(
+        const std::string& value,
+        bool& out)
+{
+    if (value == "true" || value == "on" || value == "1" || value == "yes")
+    {
+        out = true;
+        return true;
+    }
+    if (value == "false" || value == "off" || value == "0" || value == "no")
+    {
+        out = false;
+        return true;
+    }
+    return false;
+}
+
+//!Parse a whole decimal number in [min, max], false for anything else (strtoul would read garbage as 0)
+inline bool parse_int64(
+        const char* value,
+        int64_t& out,
+        int64_t min,
+        int64_t max)
+{
+    char* end = nullptr;
+    errno = 0;
+    long long parsed = std::strtoll(value, &end, 10);
+    if (end == value || *end != '\0' || errno == ERANGE || parsed < min || parsed > max)
+    {
+        return false;
+    }
+    out = parsed;
+    return true;
+}
+
+inline bool parse_uint(
+        const char* value,
+        uint32_t& out,
+        uint32_t min = 0,
+        uint32_t max = UINT32_MAX)
+{
+    int64_t parsed;
+    if (!parse_int64(value, parsed, min, max))
+    {
+        return false;
+    }
+    out = static_cast<uint32_t>(parsed);
+    return true;
+}
+
+inline bool parse_int(
+        const char* value,
+        int32_t& out,
+        int32_t min,
+        int32_t max = INT32_MAX)
+{
+    int64_t parsed;
+    if (!parse_int64(value, parsed, min, max))
+    {
+        return false;
+    }
+    out = static_cast<int32_t>(parsed);
+    return true;
+}
+
+//!Parse a finite number of 0 or more
+inline bool parse_non_negative_double(
+        const char* value,
+        double& out)
+{
+    char* end = nullptr;
+    double parsed = std::strtod(value, &end);
+    if (end == value || *end != '\0' || !(parsed >= 0) || !std::isfinite(parsed))
+    {
+        return false;
+    }
+    out = parsed;
+    return true;
+}
+
+//!Options that take no value on the command line
+inline bool is_flag_option(
+        const std::string& name)
+{
+    return name == "loan" || name == "keyed" || name == "no-csv" || name == "shared-participant" || name == "help" ||
+           name == "ping" || name == "echo" || name == "echo-header-only" || name == "verbose";
+}
+
+//!Apply one option, false if the name or the value is not valid
+inline bool apply_option(
+        MinimalConfig& config,
+        const std::string& name,
+        const std::string& value)
+{
+    const char* v = value.c_str();
+    if (name == "domain")
+    {
+        return parse_uint(v, config.domain, 0, MAX_DOMAIN_ID);
+    }
+    else if (name == "transport")
+    {
+        if (value == "shm")
+        {
+            config.transport = Transport::SHM;
+        }
+        else if (value == "udp")
+        {
+            config.transport = Transport::UDP;
+        }
+        else if (value == "large")
+        {
+            config.transport = Transport::LARGE_DATA;
+        }
+        else
+        {
+            return false;
+        }
+    }
+    else if (name == "data-sharing")
+    {
+        return parse_bool(value, config.data_sharing);
+    }
+    else if (name == "size")
+    {
+        // The segment and buffer sizes default to 10 * size
+        return parse_uint(v, config.data_size, 1, UINT32_MAX / 10);
+    }
+    else if (name == "shm-segment")
+    {
+        return parse_uint(v, config.shm_segment_size);
+    }
+    else if (name == "udp-buffer")
+    {
+        return parse_uint(v, config.udp_buffer_size);
+    }
+    else if (name == "samples")
+    {
+        return parse_uint(v, config.samples, 1);
+    }
+    else if (name == "clock")
+    {
+        return parse_clock_domain(v, config.clock);
+    }
+    else if (name == "loan")
+    {
+        return parse_bool(value, config.loan);
+    }
+    else if (name == "reliability")
+    {
+        if (value != "reliable" && value != "best-effort")
+        {
+            return false;
+        }
+        config.reliable = value == "reliable";
+    }
+    else if (name == "durability")
+    {
+        if (value != "transient-local" && value != "volatile")
+        {
+            return false;
+        }
+        config.transient_local = value == "transient-local";
+    }
+    else if (name == "history-depth")
+    {
+        return parse_int(v, config.history_depth, 1);
+    }
+    else if (name == "history")
+    {
+        if (value != "keep-last" && value != "keep-all")
+        {
+            return false;
+        }
+        config.keep_all = value == "keep-all";
+    }
+    else if (name == "max-samples")
+    {
+        return parse_int(v, config.max_samples, 0);
+    }
+    else if (name == "heartbeat-period")
+    {
+        return parse_uint(v, config.heartbeat_ms);
+    }
+    else if (name == "nack-response-delay")
+    {
+        return parse_int(v, config.nack_response_ms, -1);
+    }
+    else if (name == "heartbeat-response-delay")
+    {
+        return parse_int(v, config.heartbeat_response_ms, -1);
+    }
+    else if (name == "qos-profile")
+    {
+        return apply_qos_profile(config, value);
+    }
+    else if (name == "compression")
+    {
+        return parse_compression(v, config.compression.mode);
+    }
+    else if (name == "compression-level")
+    {
+        return parse_int(v, config.compression.level, INT32_MIN);
+    }
+    else if (name == "compression-min-size")
+    {
+        return parse_uint(v, config.compression.min_size);
+    }
+    else if (name == "compression-min-ratio")
+    {
+        return parse_positive_double(v, config.compression.min_ratio);
+    }
+    else if (name == "compression-threads")
+    {
+        return parse_uint(v, config.compression.threads, 1);
+    }
+    else if (name == "compression-chunk")
+    {
+        return parse_uint(v, config.compression.chunk_size, 1);
+    }
+    else if (name == "chunk-size")
+    {
+        return parse_uint(v, config.chunk_size);
+    }
+    else if (name == "frame-deadline")
+    {
+        return parse_uint(v, config.frame_deadline_ms);
+    }
+    else if (name == "max-frame-size")
+    {
+        return parse_uint(v, config.max_frame_size);
+    }
+    else if (name == "live-stats")
+    {
+        return parse_uint(v, config.live_stats_ms);
+    }
+    else if (name == "verbose")
+    {
+        return parse_bool(value, config.verbose);
+    }
+    else if (name == "streams")
+    {
+        return parse_uint(v, config.streams, 1);
+    }
+    else if (name == "keyed")
+    {
+        return parse_bool(value, config.keyed);
+    }
+    else if (name == "cpus")
+    {
+        return parse_cpu_list(value, config.cpus);
+    }
+    else if (name == "stream")
+    {
+        return parse_uint(v, config.stream);
+    }
+    else if (name == "file")
+    {
+        config.file = value;
+    }
+    else if (name == "frame-size")
+    {
+        return parse_uint(v, config.frame_size);
+    }
+    else if (name == "loop")
+    {
+        return parse_bool(value, config.loop);
+    }
+    else if (name == "prefetch")
+    {
+        return parse_uint(v, config.prefetch);
+    }
+    else if (name == "pipeline")
+    {
+        return parse_uint(v, config.pipeline);
+    }
+    else if (name == "publish-mode")
+    {
+        if (value != "sync" && value != "async")
+        {
+            return false;
+        }
+        config.flow.async = value == "async";
+    }
+    else if (name == "ping")
+    {
+        return parse_bool(value, config.ping);
+    }
+    else if (name == "warmup")
+    {
+        return parse_uint(v, config.warmup);
+    }
+    else if (name == "ping-timeout")
+    {
+        return parse_uint(v, config.ping_timeout_ms, 1);
+    }
+    else if (name == "flow-scheduler")
+    {
+        return parse_flow_scheduler(value, config.flow.scheduler);
+    }
+    else if (name == "flow-max-bytes")
+    {
+        return parse_int(v, config.flow.max_bytes_per_period, 0);
+    }
+    else if (name == "flow-period")
+    {
+        int64_t period_ms;
+        if (!parse_int64(v, period_ms, 1, INT64_MAX))
+        {
+            return false;
+        }
+        config.flow.period_ms = static_cast<uint64_t>(period_ms);
+    }
+    else if (name == "pacing")
+    {
+        return parse_pacing_mode(v, config.pacing.mode);
+    }
+    else if (name == "rate")
+    {
+        // The pacing period is 1 / rate: --pacing saturate is the way to send without one
+        return parse_positive_double(v, config.pacing.rate_hz);
+    }
+    else if (name == "burst")
+    {
+        // A burst of 0 would be rate pacing without the burst
+        return parse_uint(v, config.pacing.burst_size, 1);
+    }
+    else if (name == "ramp-step")
+    {
+        return parse_positive_double(v, config.pacing.ramp_step_hz);
+    }
+    else if (name == "ramp-max")
+    {
+        return parse_positive_double(v, config.pacing.ramp_max_hz);
+    }
+    else if (name == "max-write-p99")
+    {
+        return parse_positive_double(v, config.pacing.max_write_p99_us);
+    }
+    else if (name == "no-csv")
+    {
+        bool no_csv;
+        if (!parse_bool(value, no_csv))
+        {
+            return false;
+        }
+        config.export_csv = !no_csv;
+    }
+    else if (name == "report-interval")
+    {
+        double seconds;
+        if (!parse_non_negative_double(v, seconds) || seconds * 1000 > UINT32_MAX)
+        {
+            return false;
+        }
+        config.report_interval_ms = static_cast<uint32_t>(seconds * 1000);
+    }
+    else if (name == "report")
+    {
+        config.report = value;
+    }
+    else if (name == "timeout")
+    {
+        return parse_non_negative_double(v, config.timeout_s);
+    }
+    else if (name == "receive")
+    {
+        return parse_receive_engine(value, config.receive);
+    }
+    else if (name == "receive-cpu")
+    {
+        return parse_int(v, config.receive_cpu, -1, CPU_SETSIZE - 1);
+    }
+    else if (name == "spin")
+    {
+        return parse_uint(v, config.spin_us);
+    }
+    else if (name == "take-batch")
+    {
+        // take() gets the count as an int32_t
+        return parse_uint(v, config.take_batch, 0, INT32_MAX);
+    }
+    else if (name == "echo")
+    {
+        return parse_bool(value, config.echo);
+    }
+    else if (name == "echo-header-only")
+    {
+        if (!parse_bool(value, config.echo_header_only))
+        {
+            return false;
+        }
+        config.echo = config.echo || config.echo_header_only;
+    }
+    else if (name == "readers")
+    {
+        return parse_uint(v, config.readers, 1);
+    }
+    else if (name == "shared-participant")
+    {
+        return parse_bool(value, config.shared_participant);
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+//!Load "<name> = <value>" lines, '#' starts a comment
+inline bool load_config_file(
+        MinimalConfig& config,
+        const std::string& path)
+{
+    std::ifstream file(path);
+    if (!file.is_open())
+    {
+        std::cout << "Error opening config file " << path << std::endl;
+        return false;
+    }
+
+    std::string line;
+    int line_number = 0;
+    while (std::getline(file, line))
+    {
+        ++line_number;
+        line = line.substr(0, line.find('#'));
+        for (char& c : line)
+        {
+            if (c == '=')
+            {
+                c = ' ';
+            }
+        }
+        std::istringstream tokens(line);
+        std::string name;
+        std::string value;
+        if (!(tokens >> name))
+        {
+            continue;
+        }
+        if (!(tokens >> value))
+        {
+            value = "true";
+        }
+        if (!apply_option(config, name, value))
+        {
+            std::cout << path << ":" << line_number << ": invalid option '" << name << "'" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+inline void print_usage(
+        const char* program)
+{
+    std::cout << "Usage: " << program << " [--help] [--config file] [options]\n"
+              << "Common options:\n"
+              << "  --domain id                      DDS domain, 0 to 232 (0)\n"
+              << "  --transport shm|udp|large        Transport (shm)\n"
+              << "  --data-sharing on|off            Data sharing on the shm transport (on)\n"
+              << "  --size bytes                     Payload size (1000000)\n"
+              << "  --shm-segment bytes              Shared memory segment size (10 * size)\n"
+              << "  --udp-buffer bytes               UDP socket buffer sizes (10 * size)\n"
+              << "  --samples n                      Samples to send/receive (10)\n"
+              << "  --clock monotonic|realtime       Timestamp clock (monotonic)\n"
+              << "  --loan                           Use loaned MinimalFrame samples\n"
+              << "  --reliability reliable|best-effort (reliable)\n"
+              << "  --durability transient-local|volatile (transient-local)\n"
+              << "  --history-depth n                KEEP_LAST depth (1)\n"
+              << "  --history keep-last|keep-all     History kind (keep-last)\n"
+              << "  --max-samples n                  Frames per instance in the histories, preallocated\n"
+              << "                                   (0: Fast DDS limits)\n"
+              << "  --heartbeat-period ms            Reliable writer heartbeat period (0: Fast DDS default)\n"
+              << "  --nack-response-delay ms  --heartbeat-response-delay ms\n"
+              << "                                   Repair delays of the writer and reader (-1: Fast DDS default)\n"
+              << "  --qos-profile low-latency|reliable-bounded|lossless\n"
+              << "                                   Set the QoS options above at once, options given after\n"
+              << "                                   the profile override it\n"
+              << "  --compression none|lz4|zstd|auto Compress img_data (publisher; receivers decode any codec) (none)\n"
+              << "  --compression-level n            zstd level / LZ4 acceleration, 0: default (0)\n"
+              << "  --compression-min-size bytes     auto: frames below are sent raw (65536)\n"
+              << "  --compression-min-ratio r        auto: pause compression below this ratio (1.2)\n"
+              << "  --compression-threads n          Threads (de)compressing the chunks of a frame (1)\n"
+              << "  --compression-chunk bytes        Chunk size (1048576)\n"
+              << "  --chunk-size bytes               Send frames as chunks of this size, reassembled by the\n"
+              << "                                   subscriber (not with --loan or MultipleSubs) (0: off)\n"
+              << "  --frame-deadline ms              Subscriber drops a frame still missing chunks after this\n"
+              << "                                   long, 0 waits until its slot is needed (0)\n"
+              << "  --max-frame-size bytes           Receivers drop larger chunked or compressed frames (10 * size)\n"
+              << "  --live-stats ms                  Soak tests: publish rate, throughput, latency and loss of\n"
+              << "                                   each period on MinimalStatsTopic and print them as one line\n"
+              << "                                   (0: off)\n"
+              << "  --verbose                        Print a line per frame sent or received, slows fast runs\n"
+              << "Publisher options:\n"
+              << "  --streams n                      Streams (topics) published in parallel (1)\n"
+              << "  --keyed                          Streams are keyed instances of one topic (both sides)\n"
+              << "  --cpus list                      Pin stream threads, e.g. 2-5,8 (not pinned); with --pipeline\n"
+              << "                                   the CPUs after the first n go to the producer threads\n"
+              << "  --file path                      Frame file or directory of frames, {stream} is replaced\n"
+              << "                                   by the stream id (generated ./dummy.bin)\n"
+              << "  --frame-size bytes               Split the file into frames, 0 sends it whole (0)\n"
+              << "  --loop on|off                    Replay the frames until --samples are sent (on)\n"
+              << "  --prefetch n                     Frames prefetched ahead of the publisher (2)\n"
+              << "  --pipeline n                     Fill n frame buffers on a producer thread while the stream\n"
+              << "                                   thread writes, 2: double, 3: triple buffering (0: off)\n"
+              << "  --publish-mode sync|async        async: write() queues, a flow controller thread sends (sync)\n"
+              << "  --flow-scheduler fifo|round-robin|high-priority|reservation\n"
+              << "                                   Async scheduling of the streams, by stream id for the\n"
+              << "                                   priority ones (stream 0 first) (fifo)\n"
+              << "  --flow-max-bytes n               Async: bytes sent per period, 0: unlimited (0)\n"
+              << "  --flow-period ms                 Async: flow controller period (100)\n"
+              << "  --pacing rate|burst|saturate|ramp (rate)\n"
+              << "  --rate hz  --burst samples  --ramp-step hz  --ramp-max hz  --max-write-p99 us\n"
+              << "                                   (burst >= 1, the others > 0, use --pacing saturate for no limit)\n"
+              << "  --ping                           Round trip: wait for the subscriber's echo of each frame\n"
+              << "                                   (subscriber --echo), one frame in flight per stream\n"
+              << "  --warmup n                       Ping: round trips left out of the statistics (0)\n"
+              << "  --ping-timeout ms                Ping: count an echo lost after this long (1000)\n"
+              << "Subscriber options:\n"
+              << "  --stream id                      Stream (topic) to subscribe to (0)\n"
+              << "  --no-csv                         Do not export latency.csv at exit\n"
+              << "  --report-interval seconds        Periodic report interval, 0 disables (1)\n"
+              << "  --report path                    Write the final report as JSON (publisher: compression)\n"
+              << "  --timeout seconds                Give up after this long without a sample, 0 waits forever (0)\n"
+              << "  --receive listener|waitset|poll|hybrid\n"
+              << "                                   Take samples in the listener callback, or on a receive\n"
+              << "                                   thread that waits, spins, or spins then waits (listener)\n"
+              << "  --receive-cpu n                  Pin the receive thread (not pinned)\n"
+              << "  --spin us                        hybrid: spin this long without a sample before waiting (50)\n"
+              << "  --take-batch n                   Drain the reader with take() of up to n samples, 0 takes\n"
+              << "                                   one sample per wakeup in copy mode, all of them with --loan (0)\n"
+              << "  --echo                           Republish every frame on MinimalReplyTopic for --ping\n"
+              << "  --echo-header-only               Echo without img_data\n"
+              << "MultipleSubs options:\n"
+              << "  --readers k                      DataReaders on the topic (1)\n"
+              << "  --shared-participant             Create every reader in one participant\n";
+}
+
+//!Fill config from an optional --config file and then the command line options
+inline bool parse_options(
+        int argc,
+        char** argv,
+        MinimalConfig& config)
+{
+    // The config file is loaded first so command line options override it
+    for (int i = 1; i + 1 < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--config") == 0 && !load_config_file(config, argv[i + 1]))
+        {
+            return false;
+        }
+    }
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strncmp(argv[i], "--", 2) != 0)
+        {
+            std::cout << "Unexpected argument '" << argv[i] << "'" << std::endl;
+            print_usage(argv[0]);
+            return false;
+        }
+        std::string name(argv[i] + 2);
+        if (name == "help")
+        {
+            print_usage(argv[0]);
+            return false;
+        }
+        std::string value = "true";
+        if (!is_flag_option(name))
+        {
+            if (i + 1 >= argc)
+            {
+                std::cout << "Missing value for --" << name << std::endl;
+                print_usage(argv[0]);
+                return false;
+            }
+            value = argv[++i];
+        }
+        if (name != "config" && !apply_option(config, name, value))
+        {
+            std::cout << "Invalid option --" << name << " " << value << std::endl;
+            print_usage(argv[0]);
+            return false;
+        }
+    }
+    return true;
+}
+
+//!Participant QoS with the transports selected by config
+inline eprosima::fastdds::dds::DomainParticipantQos make_participant_qos(
+        const MinimalConfig& config,
+        const std::string& name)
+{
+    using namespace eprosima::fastdds::dds;
+    using namespace eprosima::fastdds::rtps;
+
+    DomainParticipantQos pqos = PARTICIPANT_QOS_DEFAULT;
+    pqos.name(name);
+    pqos.transport().use_builtin_transports = false;
+
+    switch (config.transport)
+    {
+        case Transport::SHM:
+        {
+            std::shared_ptr<SharedMemTransportDescriptor> shm_transport =
+                    std::make_shared<SharedMemTransportDescriptor>();
+            shm_transport->segment_size(config.segment_size());
+            pqos.transport().user_transports.push_back(shm_transport);
+            break;
+        }
+        case Transport::UDP:
+        {
+            auto udp_transport = std::make_shared<UDPv4TransportDescriptor>();
+            udp_transport->sendBufferSize = config.buffer_size();
+            udp_transport->receiveBufferSize = config.buffer_size();
+            udp_transport->non_blocking_send = true;
+            pqos.transport().user_transports.push_back(udp_transport);
+            break;
+        }
+        case Transport::LARGE_DATA:
+            pqos.transport().use_builtin_transports = true;
+            pqos.setup_transports(BuiltinTransports::LARGE_DATA);
+            break;
+    }
+
+    if (config.flow.async)
+    {
+        auto flow_controller = std::make_shared<FlowControllerDescriptor>();
+        flow_controller->name = MINIMAL_FLOW_CONTROLLER;
+        flow_controller->scheduler = config.flow.scheduler;
+        flow_controller->max_bytes_per_period = config.flow.max_bytes_per_period;
+        flow_controller->period_ms = config.flow.period_ms;
+        pqos.flow_controllers().push_back(flow_controller);
+    }
+    return pqos;
+}
+
+//!History and resource limits of config, counted in frames: a chunked frame takes chunks_per_frame() samples
+inline void apply_history_qos(
+        const MinimalConfig& config,
+        eprosima::fastdds::dds::HistoryQosPolicy& history,
+        eprosima::fastdds::dds::ResourceLimitsQosPolicy& limits)
+{
+    using namespace eprosima::fastdds::dds;
+
+    const int32_t chunks = static_cast<int32_t>(config.chunks_per_frame());
+    history.kind = config.keep_all ? HistoryQosPolicyKind::KEEP_ALL_HISTORY_QOS :
+            HistoryQosPolicyKind::KEEP_LAST_HISTORY_QOS;
+    history.depth = config.history_depth * chunks;
+    if (config.max_samples > 0)
+    {
+        // Bounded memory: the history is allocated at its limit once and never grows
+        const int32_t instances = config.keyed ? static_cast<int32_t>(config.streams) : 1;
+        limits.max_samples_per_instance = std::max(config.max_samples * chunks,
+                        config.keep_all ? 1 : history.depth);
+        limits.max_instances = instances;
+        limits.max_samples = limits.max_samples_per_instance * instances;
+        limits.allocated_samples = limits.max_samples;
+        return;
+    }
+    // A chunked frame needs room for all its chunks, past the default limits if need be
+    if (limits.max_samples_per_instance < history.depth)
+    {
+        limits.max_samples_per_instance = history.depth;
+    }
+    if (limits.max_samples > 0 && limits.max_samples < history.depth)
+    {
+        limits.max_samples = history.depth;
+    }
+}
+
+//!Apply the reliability, durability, history, data sharing and publish mode settings of config
+inline void apply_writer_qos(
+        const MinimalConfig& config,
+        eprosima::fastdds::dds::DataWriterQos& qos,
+        uint32_t stream_id = 0)
+{
+    using namespace eprosima::fastdds::dds;
+
+    qos.reliability().kind = config.reliable ?
+            ReliabilityQosPolicyKind::RELIABLE_RELIABILITY_QOS :
+            ReliabilityQosPolicyKind::BEST_EFFORT_RELIABILITY_QOS;
+    qos.durability().kind = config.transient_local ?
+            DurabilityQosPolicyKind::TRANSIENT_LOCAL_DURABILITY_QOS :
+            DurabilityQosPolicyKind::VOLATILE_DURABILITY_QOS;
+    apply_history_qos(config, qos.history(), qos.resource_limits());
+    if (config.heartbeat_ms > 0)
+    {
+        qos.reliable_writer_qos().times.heartbeat_period = Duration_t(config.heartbeat_ms / 1e3);
+    }
+    if (config.nack_response_ms >= 0)
+    {
+        qos.reliable_writer_qos().times.nack_response_delay = Duration_t(config.nack_response_ms / 1e3);
+    }
+    if (config.uses_data_sharing())
+    {
+        qos.data_sharing().automatic();
+    }
+    else
+    {
+        qos.data_sharing().off();
+    }
+
+    if (config.flow.async)
+    {
+        using eprosima::fastdds::rtps::FlowControllerSchedulerPolicy;
+
+        qos.publish_mode().kind = PublishModeQosPolicyKind::ASYNCHRONOUS_PUBLISH_MODE;
+        qos.publish_mode().flow_controller_name = MINIMAL_FLOW_CONTROLLER;
+        // Priorities go from -10 (highest) to 10, reservations share the bandwidth evenly
+        if (config.flow.scheduler == FlowControllerSchedulerPolicy::HIGH_PRIORITY ||
+                config.flow.scheduler == FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION)
+        {
+            qos.properties().properties().emplace_back("fastdds.sfc.priority",
+                    std::to_string(static_cast<int>(std::min<uint32_t>(stream_id, 20)) - 10));
+        }
+        if (config.flow.scheduler == FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION)
+        {
+            qos.properties().properties().emplace_back("fastdds.sfc.bandwidth_reservation",
+                    std::to_string(100 / config.streams));
+        }
+    }
+}
+
+//!Reader counterpart of apply_writer_qos
+inline void apply_reader_qos(
+        const MinimalConfig& config,
+        eprosima::fastdds::dds::DataReaderQos& qos)
+{
+    using namespace eprosima::fastdds::dds;
+
+    qos.reliability().kind = config.reliable ?
+            ReliabilityQosPolicyKind::RELIABLE_RELIABILITY_QOS :
+            ReliabilityQosPolicyKind::BEST_EFFORT_RELIABILITY_QOS;
+    qos.durability().kind = config.transient_local ?
+            DurabilityQosPolicyKind::TRANSIENT_LOCAL_DURABILITY_QOS :
+            DurabilityQosPolicyKind::VOLATILE_DURABILITY_QOS;
+    apply_history_qos(config, qos.history(), qos.resource_limits());
+    if (config.heartbeat_response_ms >= 0)
+    {
+        qos.reliable_reader_qos().times.heartbeat_response_delay = Duration_t(config.heartbeat_response_ms / 1e3);
+    }
+    if (config.uses_data_sharing())
+    {
+        qos.data_sharing().automatic();
+    }
+    else
+    {
+        qos.data_sharing().off();
+    }
+}
+
+#endif // MINIMAL_CONFIG_HPP
@@ -0,0 +1,352 @@
+// Hand-tuned TopicDataTypes layered on the generated Minimal support code
+
+#ifndef MINIMAL_FAST_TYPES_HPP
+#define MINIMAL_FAST_TYPES_HPP
+
+#include <cstdint>
+#include <cstring>
+
+#include <fastdds/utils/md5.hpp>
+
+#include "MinimalPubSubTypes.hpp"
+#include "frame_pool.hpp"
+
+namespace minimal_wire {
+
+// RTPS encapsulation identifiers, big endian flavour (the low bit selects little endian).
+// Not named CDR_BE & co, Fast DDS defines those as macros.
+const uint16_t XCDR1_PLAIN_BE = 0x0000;
+const uint16_t XCDR2_PLAIN_BE = 0x0006;
+const uint16_t XCDR2_DELIMITED_BE = 0x0008;
+
+const bool HOST_LITTLE_ENDIAN = __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__;
+
+//!Representation identifier of a serialized payload
+inline uint16_t encapsulation(
+        const eprosima::fastdds::rtps::SerializedPayload_t& payload)
+{
+    return static_cast<uint16_t>((payload.data[0] << 8) | payload.data[1]);
+}
+
+//!Read the uint32 at offset (from the start of the payload, header included)
+inline bool read_uint32(
+        const eprosima::fastdds::rtps::SerializedPayload_t& payload,
+        uint32_t offset,
+        uint32_t& value)
+{
+    if (payload.length < offset + 4)
+    {
+        return false;
+    }
+    std::memcpy(&value, payload.data + offset, 4);
+    if (((encapsulation(payload) & 0x0001) != 0) != HOST_LITTLE_ENDIAN)
+    {
+        value = __builtin_bswap32(value);
+    }
+    return true;
+}
+
+inline bool read_uint64(
+        const eprosima::fastdds::rtps::SerializedPayload_t& payload,
+        uint32_t offset,
+        uint64_t& value)
+{
+    if (payload.length < offset + 8)
+    {
+        return false;
+    }
+    std::memcpy(&value, payload.data + offset, 8);
+    if (((encapsulation(payload) & 0x0001) != 0) != HOST_LITTLE_ENDIAN)
+    {
+        value = __builtin_bswap64(value);
+    }
+    return true;
+}
+
+// The generated compute_key(payload) deserializes the whole sample (an 8 MB
+// heap allocation and copy for MinimalFrame) just to serialize its key again.
+// stream_id is the only key member and sits at a fixed offset of every
+// encoding these types use, so the key hash can be read straight from the
+// payload. The result is bit for bit the hash of the generated code: the key
+// serialized big endian in a zeroed 16 byte buffer, or its MD5 when forced.
+inline void stream_handle(
+        uint32_t stream_id,
+        eprosima::fastdds::rtps::InstanceHandle_t& handle,
+        bool force_md5,
+        eprosima::fastdds::MD5& md5)
+{
+    unsigned char key[16] = {
+        static_cast<unsigned char>(stream_id >> 24), static_cast<unsigned char>(stream_id >> 16),
+        static_cast<unsigned char>(stream_id >> 8), static_cast<unsigned char>(stream_id)};
+    if (force_md5)
+    {
+        md5.init();
+        md5.update(key, 4);
+        md5.finalize();
+        for (uint8_t i = 0; i < 16; ++i)
+        {
+            handle.value[i] = md5.digest[i];
+        }
+    }
+    else
+    {
+        for (uint8_t i = 0; i < 16; ++i)
+        {
+            handle.value[i] = key[i];
+        }
+    }
+}
+
+//!stream_id as the first member of an appendable type: after the DHEADER in XCDR2, at the start of the
+//!body in XCDR1. False for any other encoding
+inline bool read_leading_key(
+        const eprosima::fastdds::rtps::SerializedPayload_t& payload,
+        uint32_t& stream_id)
+{
+    uint16_t id = payload.length >= 4 ? encapsulation(payload) & ~0x0001 : 0xFFFF;
+    if (id == XCDR2_DELIMITED_BE)
+    {
+        return read_uint32(payload, 4 + 4, stream_id);
+    }
+    if (id == XCDR1_PLAIN_BE)
+    {
+        return read_uint32(payload, 4, stream_id);
+    }
+    return false;
+}
+
+} // namespace minimal_wire
+
+// Minimal has a fixed layout: five scalars and an octet sequence, with the
+// same offsets in both encodings (body offsets, XCDR2 after its DHEADER):
+//   stream_id 0, index 4, time_stamp 8, raw_size 16, codec 20, padding 21-23,
+//   img_data length 24, img_data 28
+// so its size is known in O(1) and serialization is a header plus one memcpy
+// of img_data. The bytes are those of the generated code: DELIMIT_CDR2
+// (DHEADER first) for XCDR2, PLAIN_CDR for XCDR1, host endianness, options 0.
+// Anything else (e.g. a payload from a writer with a newer appendable version
+// that does not fit) goes to the generated code.
+// Samples created by the middleware (create_data) come from a FramePool and
+// are recycled by delete_data, so their buffers are reused across samples.
+class MinimalFastPubSubType : public MinimalPubSubType
+{
+    public:
+        // Fixed part of the body, DHEADER excluded
+        static const uint32_t FIXED_BODY_SIZE = 4 + 4 + 8 + 4 + 4 + 4;
+
+        using MinimalPubSubType::compute_key;
+
+        bool serialize(
+                const void* const data,
+                eprosima::fastdds::rtps::SerializedPayload_t& payload,
+                eprosima::fastdds::dds::DataRepresentationId_t data_representation) override
+        {
+            const Minimal* p_type = static_cast<const Minimal*>(data);
+            const bool xcdr2 = data_representation != eprosima::fastdds::dds::XCDR_DATA_REPRESENTATION;
+            const uint32_t img_size = static_cast<uint32_t>(p_type->img_data().size());
+            const uint32_t length = serialized_size(xcdr2, img_size);
+            if (payload.max_size < length)
+            {
+                return false;
+            }
+
+            unsigned char* out = payload.data;
+            out[0] = 0;
+            out[1] = static_cast<unsigned char>((xcdr2 ? minimal_wire::XCDR2_DELIMITED_BE :
+                    minimal_wire::XCDR1_PLAIN_BE) | (minimal_wire::HOST_LITTLE_ENDIAN ? 1 : 0));
+            out[2] = 0;
+            out[3] = 0;
+            out += 4;
+            if (xcdr2)
+            {
+                out = put(out, FIXED_BODY_SIZE + img_size);
+            }
+            out = put(out, p_type->stream_id());
+            out = put(out, p_type->index());
+            out = put(out, p_type->time_stamp());
+            out = put(out, p_type->raw_size());
+            out = put(out, p_type->codec());
+            out = put(out, static_cast<uint8_t>(0));
+            out = put(out, static_cast<uint16_t>(0));
+            out = put(out, img_size);
+            if (img_size > 0)
+            {
+                std::memcpy(out, p_type->img_data().data(), img_size);
+            }
+
+            payload.encapsulation = minimal_wire::HOST_LITTLE_ENDIAN ? CDR_LE : CDR_BE;
+            payload.length = length;
+            return true;
+        }
+
+        bool deserialize(
+                eprosima::fastdds::rtps::SerializedPayload_t& payload,
+                void* data) override
+        {
+            uint16_t id = payload.length >= 4 ? minimal_wire::encapsulation(payload) & ~0x0001 : 0xFFFF;
+            if (id != minimal_wire::XCDR2_DELIMITED_BE && id != minimal_wire::XCDR1_PLAIN_BE)
+            {
+                return MinimalPubSubType::deserialize(payload, data);
+            }
+
+            Minimal* p_type = static_cast<Minimal*>(data);
+            uint32_t offset = 4;
+            uint32_t body_end = payload.length;
+            if (id == minimal_wire::XCDR2_DELIMITED_BE)
+            {
+                uint32_t dheader = 0;
+                if (!minimal_wire::read_uint32(payload, offset, dheader) || dheader > payload.length - 8)
+                {
+                    return false;
+                }
+                offset += 4;
+                body_end = offset + dheader;
+            }
+
+            uint32_t stream_id = 0;
+            uint32_t index = 0;
+            uint64_t time_stamp = 0;
+            uint32_t raw_size = 0;
+            uint32_t img_size = 0;
+            if (body_end < offset + FIXED_BODY_SIZE ||
+                    !minimal_wire::read_uint32(payload, offset, stream_id) ||
+                    !minimal_wire::read_uint32(payload, offset + 4, index) ||
+                    !minimal_wire::read_uint64(payload, offset + 8, time_stamp) ||
+                    !minimal_wire::read_uint32(payload, offset + 16, raw_size) ||
+                    !minimal_wire::read_uint32(payload, offset + 24, img_size) ||
+                    img_size > body_end - offset - FIXED_BODY_SIZE)
+            {
+                return false;
+            }
+
+            const unsigned char* img = payload.data + offset + FIXED_BODY_SIZE;
+            p_type->stream_id(stream_id);
+            p_type->index(index);
+            p_type->time_stamp(time_stamp);
+            p_type->raw_size(raw_size);
+            p_type->codec(payload.data[offset + 20]);
+            size_t capacity = p_type->img_data().capacity();
+            p_type->img_data().assign(img, img + img_size);
+            if (p_type->img_data().capacity() != capacity)
+            {
+                pool_.note_growth();
+            }
+            payload.encapsulation = (minimal_wire::encapsulation(payload) & 0x0001) ? CDR_LE : CDR_BE;
+            return true;
+        }
+
+        void* create_data() override
+        {
+            return pool_.acquire();
+        }
+
+        void delete_data(
+                void* data) override
+        {
+            pool_.release(static_cast<Minimal*>(data));
+        }
+
+        //!Pool behind create_data/delete_data, also counts the buffer growths of deserialize
+        FramePool& pool()
+        {
+            return pool_;
+        }
+
+        uint32_t calculate_serialized_size(
+                const void* const data,
+                eprosima::fastdds::dds::DataRepresentationId_t data_representation) override
+        {
+            return serialized_size(data_representation != eprosima::fastdds::dds::XCDR_DATA_REPRESENTATION,
+                           static_cast<uint32_t>(static_cast<const Minimal*>(data)->img_data().size()));
+        }
+
+        //!stream_id is the first member: after the DHEADER in XCDR2, at the start of the body in XCDR1
+        bool compute_key(
+                eprosima::fastdds::rtps::SerializedPayload_t& payload,
+                eprosima::fastdds::rtps::InstanceHandle_t& handle,
+                bool force_md5 = false) override
+        {
+            uint32_t stream_id = 0;
+            if (!minimal_wire::read_leading_key(payload, stream_id))
+            {
+                return MinimalPubSubType::compute_key(payload, handle, force_md5);
+            }
+            minimal_wire::stream_handle(stream_id, handle, force_md5, md5_);
+            return true;
+        }
+
+        //!Encapsulation + (DHEADER) + fixed members + img_data
+        static uint32_t serialized_size(
+                bool xcdr2,
+                uint32_t img_size)
+        {
+            return 4 + (xcdr2 ? 4 : 0) + FIXED_BODY_SIZE + img_size;
+        }
+
+    private:
+
+        template<typename T>
+        static unsigned char* put(
+                unsigned char* out,
+                T value)
+        {
+            std::memcpy(out, &value, sizeof(value));
+            return out + sizeof(value);
+        }
+
+        eprosima::fastdds::MD5 md5_;
+        FramePool pool_;
+};
+
+class MinimalFrameFastPubSubType : public MinimalFramePubSubType
+{
+    public:
+        using MinimalFramePubSubType::compute_key;
+
+        //!stream_id follows the 8 byte time_stamp in both encodings (final type, no DHEADER)
+        bool compute_key(
+                eprosima::fastdds::rtps::SerializedPayload_t& payload,
+                eprosima::fastdds::rtps::InstanceHandle_t& handle,
+                bool force_md5 = false) override
+        {
+            uint32_t stream_id = 0;
+            uint16_t id = payload.length >= 4 ? minimal_wire::encapsulation(payload) & ~0x0001 : 0xFFFF;
+            if ((id != minimal_wire::XCDR2_PLAIN_BE && id != minimal_wire::XCDR1_PLAIN_BE) ||
+                    !minimal_wire::read_uint32(payload, 4 + 8, stream_id))
+            {
+                return MinimalFramePubSubType::compute_key(payload, handle, force_md5);
+            }
+            minimal_wire::stream_handle(stream_id, handle, force_md5, md5_);
+            return true;
+        }
+
+    private:
+        eprosima::fastdds::MD5 md5_;
+};
+
+// MinimalChunk is appendable and starts with stream_id too, so its key sits
+// where Minimal's does. Every chunk of a frame computes a key on the reader.
+class MinimalChunkFastPubSubType : public MinimalChunkPubSubType
+{
+    public:
+        using MinimalChunkPubSubType::compute_key;
+
+        bool compute_key(
+                eprosima::fastdds::rtps::SerializedPayload_t& payload,
+                eprosima::fastdds::rtps::InstanceHandle_t& handle,
+                bool force_md5 = false) override
+        {
+            uint32_t stream_id = 0;
+            if (!minimal_wire::read_leading_key(payload, stream_id))
+            {
+                return MinimalChunkPubSubType::compute_key(payload, handle, force_md5);
+            }
+            minimal_wire::stream_handle(stream_id, handle, force_md5, md5_);
+            return true;
+        }
+
+    private:
+        eprosima::fastdds::MD5 md5_;
+};
+
+#endif // MINIMAL_FAST_TYPES_HPP
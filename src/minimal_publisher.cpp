@@ -2,12 +2,25 @@
 // Inspired by the HelloWorld example from FastDDS 
 
 #include "MinimalPubSubTypes.hpp"
+#include "minimal_fast_types.hpp"
+#include "frame_source.hpp"
+#include "latency_histogram.hpp"
+#include "live_stats.hpp"
+#include "minimal_clock.hpp"
+#include "minimal_config.hpp"
+#include "rate_controller.hpp"
+#include "spsc_ring.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cstring>
 #include <thread>
 #include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
 #include <vector>
-#include <sys/time.h>
 #include <time.h>
 #include <numeric>  // for std::iota
 
@@ -16,6 +29,11 @@
 #include <fastdds/dds/publisher/DataWriter.hpp>
 #include <fastdds/dds/publisher/DataWriterListener.hpp>
 #include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/DataReaderListener.hpp>
+#include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
+#include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
 #include <fastdds/dds/topic/TypeSupport.hpp>
 #include <fastdds/rtps/attributes/BuiltinTransports.hpp>
 #include <fastdds/rtps/transport/shared_mem/SharedMemTransportDescriptor.hpp>
@@ -27,26 +45,15 @@
 using namespace eprosima::fastdds::dds;
 using namespace eprosima::fastdds::rtps;
 
-#define IMG_TRANSFER 0
-
-#define DATA_SIZE 1000*1000
-#define SHM_SEGMENT_SIZE DATA_SIZE*10  // 10*DATA_SIZE (can be tuned)
-#define UDP_BUF_SIZE DATA_SIZE*10      // 10*DATA_SIZE (can be tuned)
-
-#define SHM_TRANSPORT 1         // Uses data sharing as well (check wqos.data_sharing().automatic();) 
-#define UDP_TRANSPORT 0
-#define LARGE_TRANSPORT 0
-#define SLEEP_TIME_MS 1000
+enum class PublishMode
+{
+    COPY,       // Minimal samples, serialized by writer_->write()
+    LOAN        // MinimalFrame samples loaned from the DataWriter and filled in place
+};
 
 class MinimalPublisher
 {
     private:
-        Minimal minimal_;
-        DomainParticipant* participant_;
-        Publisher* publisher_;
-        Topic* topic_;
-        DataWriter* writer_;
-        TypeSupport type_;
 
     class PubListener : public DataWriterListener
     {
@@ -64,14 +71,15 @@ class MinimalPublisher
                     DataWriter*,
                     const PublicationMatchedStatus& info) override
             {
+                // Readers matched now: total_count never goes down when one leaves
                 if (info.current_count_change == 1)
                 {
-                    matched_ = info.total_count;
+                    matched_ = info.current_count;
                     std::cout << "Publisher matched." << std::endl;
                 }
                 else if (info.current_count_change == -1)
                 {
-                    matched_ = info.total_count;
+                    matched_ = info.current_count;
                     std::cout << "Publisher unmatched." << std::endl;
                 }
                 else
@@ -83,70 +91,931 @@ class MinimalPublisher
 
             std::atomic_int matched_;
 
-    }listner_;
+    };
+
+    // Keeps the echo writers matched with a stream's reply reader (ping), read on every send
+    class ReplyListener : public DataReaderListener
+    {
+        public:
+            ReplyListener()
+                : matched_(0)
+            {
+            }
+
+            void on_subscription_matched(
+                    DataReader*,
+                    const SubscriptionMatchedStatus& info) override
+            {
+                matched_ = info.current_count;
+            }
+
+            std::atomic_int matched_;
+    };
+
+    // One camera stream: its own DataWriter, sample and frame source, published
+    // from its own thread. Every stream shares the participant. Streams have
+    // their own topic, or are keyed instances (stream_id) of a shared one.
+    class Stream
+    {
+        public:
+            Stream(
+                    uint32_t id,
+                    const MinimalConfig& config)
+                : id_(id)
+                , config_(config)
+                , mode_(config.loan ? PublishMode::LOAN : PublishMode::COPY)
+                , clock_(config.clock)
+                , encoder_(config.compression)
+                , encoded_(false)
+                , writer_(nullptr)
+                , samples_sent_(0)
+                , bytes_sent_(0)
+                , reply_reader_(nullptr)
+                , round_trips_(0)
+                , echoes_lost_(0)
+                , stop_(false)
+                , exhausted_(false)
+                , producer_waits_(0)
+            {
+            }
+
+            //!Create the DataWriter of this stream, and its echo reader when reply_topic is given (ping)
+            bool init(
+                    Publisher* publisher,
+                    Topic* topic,
+                    TypeSupport& type,
+                    Subscriber* subscriber,
+                    Topic* reply_topic)
+            {
+                type_ = type;
+                minimal_.stream_id(id_);
+                minimal_.index(0);
+                minimal_.time_stamp(0);
+
+                // Create the DataWriter
+                DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+                publisher->get_default_datawriter_qos(writer_qos);
+                apply_writer_qos(config_, writer_qos, id_);
+
+                writer_ = publisher->create_datawriter(topic, writer_qos, &listner_);
+
+                if (writer_ == nullptr)
+                {
+                    return false;
+                }
+
+                if (reply_topic != nullptr)
+                {
+                    DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+                    subscriber->get_default_datareader_qos(reader_qos);
+                    apply_reader_qos(config_, reader_qos);
+                    reply_reader_ = subscriber->create_datareader(reply_topic, reader_qos, &reply_listener_,
+                                    StatusMask::subscription_matched());
+                    if (reply_reader_ == nullptr)
+                    {
+                        return false;
+                    }
+                    if (id_ == 0 && config_.pipeline > 0)
+                    {
+                        std::cout << "Ping keeps one frame in flight per stream: --pipeline is ignored." << std::endl;
+                    }
+                }
+
+                if (id_ == 0 && config_.compression.mode != Compression::NONE)
+                {
+                    if (mode_ == PublishMode::LOAN)
+                    {
+                        std::cout << "Compression applies to Minimal samples: loaned MinimalFrame samples are sent raw."
+                                  << std::endl;
+                    }
+                    else if (encoder_.codec() == Codec::NONE)
+                    {
+                        std::cout << "The requested codec is not built in: frames are sent raw." << std::endl;
+                    }
+                }
+
+                if (id_ == 0 && config_.flow.async && writer_qos.data_sharing().kind() != DataSharingKind::OFF)
+                {
+                    std::cout << "Asynchronous writer with data sharing: data sharing readers are not paced "
+                              << "by the flow controller." << std::endl;
+                }
+
+                if (id_ == 0 && config_.chunk_size > 0)
+                {
+                    if (mode_ == PublishMode::LOAN)
+                    {
+                        std::cout << "Chunks apply to Minimal samples: loaned MinimalFrame samples are sent whole."
+                                  << std::endl;
+                    }
+                    else
+                    {
+                        std::cout << "Frames are sent as chunks of " << config_.chunk_size << " bytes ("
+                                  << config_.chunks_per_frame() << " per " << config_.data_size << " byte frame)."
+                                  << std::endl;
+                    }
+                }
+
+                if (mode_ == PublishMode::LOAN)
+                {
+                    if (!type->is_plain(XCDR_DATA_REPRESENTATION))
+                    {
+                        std::cout << "Type " << type.get_type_name()
+                                  << " is not plain, samples cannot be loaned. Falling back to copies." << std::endl;
+                        frame_.reset(new MinimalFrame());
+                    }
+                    else if (id_ == 0 && writer_qos.data_sharing().kind() == DataSharingKind::OFF)
+                    {
+                        std::cout << "Data sharing is disabled: loans avoid the serialization copy, "
+                                  << "but the transport still copies every frame." << std::endl;
+                    }
+                }
+                return true;
+            }
+
+            void destroy(
+                    Publisher* publisher,
+                    Subscriber* subscriber)
+            {
+                if (writer_ != nullptr)
+                {
+                    publisher->delete_datawriter(writer_);
+                    writer_ = nullptr;
+                }
+                if (reply_reader_ != nullptr)
+                {
+                    subscriber->delete_datareader(reply_reader_);
+                    reply_reader_ = nullptr;
+                }
+            }
+
+            //!Send a publication
+            bool publish(const Frame& source)
+            {
+                if (listner_.matched_ > 0)
+                {
+                    // Copied (or compressed) once per frame from the mapping into the sample, the vector keeps
+                    // its capacity and a retry sends the same img_data
+                    if (!encoded_)
+                    {
+                        minimal_.codec(static_cast<uint8_t>(encoder_.encode(source.data, source.size,
+                                minimal_.img_data())));
+                        minimal_.raw_size(static_cast<uint32_t>(source.size));
+                        encoded_ = true;
+                    }
+                    minimal_.index(minimal_.index() + 1);
+                    minimal_.time_stamp(now_ns(clock_));
+                    if (write_frame(minimal_))
+                    {
+                        return true;
+                    }
+                    // Not sent (e.g. a full KEEP_ALL history): retried with the same index
+                    minimal_.index(minimal_.index() - 1);
+                }
+                return false;
+            }
+
+            //!Write sample whole, or as config.chunk_size chunks; false on the first chunk not written
+            bool write_frame(
+                    const Minimal& sample)
+            {
+                if (!config_.chunked())
+                {
+                    return writer_->write(&sample) == RETCODE_OK;
+                }
+
+                // A retried frame keeps its index, the reader drops the chunks it already has
+                const std::vector<uint8_t>& data = sample.img_data();
+                const uint32_t frame_size = static_cast<uint32_t>(data.size());
+                const uint32_t chunk_size = config_.chunk_size;
+                const uint32_t count = frame_size > 0 ? (frame_size - 1) / chunk_size + 1 : 1;
+                chunk_.stream_id(sample.stream_id());
+                chunk_.index(sample.index());
+                chunk_.time_stamp(sample.time_stamp());
+                chunk_.raw_size(sample.raw_size());
+                chunk_.codec(sample.codec());
+                chunk_.frame_size(frame_size);
+                chunk_.chunk_count(count);
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    const uint32_t offset = i * chunk_size;
+                    const uint32_t size = std::min(chunk_size, frame_size - offset);
+                    chunk_.offset(offset);
+                    chunk_.chunk_index(i);
+                    // chunk_.data() keeps its capacity, only the first frame allocates
+                    chunk_.data().assign(data.begin() + offset, data.begin() + offset + size);
+                    if (writer_->write(&chunk_) != RETCODE_OK)
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            //!Send a publication filling a sample loaned from the DataWriter
+            bool publish_loan(const Frame& source)
+            {
+                const size_t size = source.size;
+                if (listner_.matched_ == 0)
+                {
+                    return false;
+                }
+
+                if (size > MINIMAL_FRAME_CAPACITY)
+                {
+                    std::cout << "Frame of " << size << " bytes does not fit in MinimalFrame (capacity "
+                              << MINIMAL_FRAME_CAPACITY << " bytes)" << std::endl;
+                    return false;
+                }
+
+                void* sample = nullptr;
+                if (!frame_)
+                {
+                    // The loan is not initialized: every header field and img_size bytes of payload are written below
+                    ReturnCode_t ret = writer_->loan_sample(sample);
+                    if (ret == RETCODE_ILLEGAL_OPERATION || ret == RETCODE_UNSUPPORTED)
+                    {
+                        std::cout << "DataWriter cannot loan samples (" << ret
+                                  << "). Falling back to copies." << std::endl;
+                        frame_.reset(new MinimalFrame());
+                    }
+                    else if (ret != RETCODE_OK)
+                    {
+                        // Loan pool exhausted: the frame is dropped and retried on the next cycle
+                        return false;
+                    }
+                }
+
+                MinimalFrame* frame = frame_ ? frame_.get() : static_cast<MinimalFrame*>(sample);
+                std::memcpy(frame->img_data().data(), source.data, size);
+                frame->img_size(static_cast<uint32_t>(size));
+
+                minimal_.index(minimal_.index() + 1);
+                minimal_.time_stamp(now_ns(clock_));
+                frame->stream_id(id_);
+                frame->index(minimal_.index());
+                frame->time_stamp(minimal_.time_stamp());
+
+                if (writer_->write(frame) != RETCODE_OK)
+                {
+                    if (sample != nullptr)
+                    {
+                        writer_->discard_loan(sample);
+                    }
+                    return false;
+                }
+                return true;
+            }
+
+            //!Publish config.samples frames (stream thread)
+            void run()
+            {
+                // e.g. --file ../src/img.png to send an actual image
+                std::string path = config_.file.empty() ? "./dummy.bin" : config_.file;
+                size_t placeholder = path.find("{stream}");
+                if (placeholder != std::string::npos)
+                {
+                    path.replace(placeholder, 8, std::to_string(id_));
+                }
+
+                // Frames are served from a read-only mapping of the file(s)
+                MappedFrameSource source(config_.loop, config_.prefetch);
+                if (!source.open(path, config_.frame_size))
+                {
+                    return;
+                }
+                if (mode_ == PublishMode::LOAN && source.max_size() > MINIMAL_FRAME_CAPACITY)
+                {
+                    std::cout << "Frames of up to " << source.max_size() << " bytes do not fit in MinimalFrame (capacity "
+                              << MINIMAL_FRAME_CAPACITY << " bytes)" << std::endl;
+                    return;
+                }
+                std::cout << "Stream " << id_ << ": publishing " << source.frame_count() << " frame(s) from " << path
+                          << (config_.loop ? " in a loop" : "") << " on " << config_.topic_name(id_) << std::endl;
+
+                if (config_.pipeline > 0 && reply_reader_ == nullptr)
+                {
+                    run_pipeline(source);
+                }
+                else
+                {
+                    run_serial(source);
+                }
+                end_ = std::chrono::steady_clock::now();
+
+                std::cout << "Stream " << id_ << " " << (config_.flow.async ? "async" : "sync") << " write(): avg "
+                          << write_latency_.mean() / 1e3 << " us, p50 " << write_latency_.value_at_percentile(50) / 1e3
+                          << " us, p99 " << write_latency_.value_at_percentile(99) / 1e3 << " us, max "
+                          << write_latency_.max() / 1e3 << " us" << std::endl;
+                if (reply_reader_ != nullptr)
+                {
+                    std::cout << "Stream " << id_ << " round trip: " << rtt_.count() << " echoes ("
+                              << std::min(round_trips_, static_cast<uint64_t>(config_.warmup))
+                              << " warmup not counted), " << echoes_lost_ << " lost, RTT us min/p50/p90/p99/max: "
+                              << rtt_.min() / 1e3 << "/" << rtt_.value_at_percentile(50) / 1e3 << "/"
+                              << rtt_.value_at_percentile(90) / 1e3 << "/" << rtt_.value_at_percentile(99) / 1e3
+                              << "/" << rtt_.max() / 1e3 << std::endl;
+                }
+                if (codec() != Codec::NONE)
+                {
+                    std::cout << "Stream " << id_ << " " << codec_name(codec()) << ": "
+                              << encoder_.stats().to_string("encode") << std::endl;
+                }
+
+                // Do not tear the writer down while reliable samples are still in flight
+                if (config_.reliable && writer_->wait_for_acknowledgments(Duration_t(5, 0)) != RETCODE_OK)
+                {
+                    std::cout << "Stream " << id_ << ": not every sample was acknowledged" << std::endl;
+                }
+            }
+
+            uint32_t id() const
+            {
+                return id_;
+            }
+
+            uint64_t samples_sent() const
+            {
+                return samples_sent_;
+            }
+
+            uint64_t bytes_sent() const
+            {
+                return bytes_sent_;
+            }
+
+            //!Codec of the published samples, loaned frames are never compressed
+            Codec codec() const
+            {
+                return mode_ == PublishMode::COPY ? encoder_.codec() : Codec::NONE;
+            }
+
+            const CodecStats& codec_stats() const
+            {
+                return encoder_.stats();
+            }
+
+            //!Duration of every publish attempt, from the call to write() (all chunks of a frame) to its return
+            const LatencyHistogram& write_latency() const
+            {
+                return write_latency_;
+            }
+
+            //!Round trip times after the warmup (ping only)
+            const LatencyHistogram& round_trip() const
+            {
+                return rtt_;
+            }
+
+            uint64_t echoes_lost() const
+            {
+                return echoes_lost_;
+            }
+
+            //!Readers matched with the stream's writer now
+            uint32_t matched() const
+            {
+                return static_cast<uint32_t>(listner_.matched_.load());
+            }
+
+            //!Frames written since the last drain (config.live_stats_ms > 0)
+            SendWindow& live_window()
+            {
+                return live_window_;
+            }
+
+            //!Time between the first match and the last sample
+            double seconds() const
+            {
+                return samples_sent_ == 0 ? 0.0 : std::chrono::duration<double>(end_ - start_).count();
+            }
+
+        private:
+
+            // One frame buffer of the pipeline
+            struct Slot
+            {
+                void* owned = nullptr;      // Sample of the slot, from pool_ (copy) or the type's create_data (loan)
+                void* sample = nullptr;     // Filled sample: owned, or a loan from the DataWriter
+                bool loaned = false;
+                uint32_t size = 0;
+                std::chrono::steady_clock::time_point ready;  // When the producer queued it
+            };
+
+            // Time spent in one pipeline stage
+            struct StageTime
+            {
+                uint64_t count = 0;
+                uint64_t total_ns = 0;
+                uint64_t max_ns = 0;
+
+                void add(
+                        uint64_t ns)
+                {
+                    ++count;
+                    total_ns += ns;
+                    max_ns = std::max(max_ns, ns);
+                }
+
+                std::string to_string() const
+                {
+                    std::ostringstream text;
+                    text << "avg " << (count > 0 ? total_ns / 1e3 / count : 0.0) << " us, max " << max_ns / 1e3 << " us";
+                    return text.str();
+                }
+            };
+
+            static uint64_t elapsed_ns(
+                    std::chrono::steady_clock::time_point since)
+            {
+                return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           std::chrono::steady_clock::now() - since).count());
+            }
+
+            //!False (after a short sleep) while no reader is matched, restarts the pacing on a new match
+            bool ready_to_send(
+                    RateController& pacer,
+                    bool& was_matched)
+            {
+                if (listner_.matched_ == 0 || !echo_matched())
+                {
+                    was_matched = false;
+                    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                    return false;
+                }
+                if (!was_matched)
+                {
+                    was_matched = true;
+                    pacer.restart();
+                    start_ = std::chrono::steady_clock::now();
+                }
+                return true;
+            }
+
+            //!True unless pinging without a matched echo writer
+            bool echo_matched() const
+            {
+                return reply_reader_ == nullptr || reply_listener_.matched_ > 0;
+            }
+
+            //!Wait for the echo of frame index and record its round trip, false if it is not back in time.
+            //!Both ends of the round trip are read from clock_ in this process.
+            bool await_echo(
+                    uint32_t index)
+            {
+                const auto deadline = std::chrono::steady_clock::now() +
+                        std::chrono::milliseconds(config_.ping_timeout_ms);
+                SampleInfo info;
+                while (true)
+                {
+                    while (reply_reader_->take_next_sample(&reply_, &info) == RETCODE_OK)
+                    {
+                        // Late echoes of frames already counted lost are dropped
+                        if (info.valid_data && reply_.stream_id() == id_ && reply_.index() == index)
+                        {
+                            uint64_t rtt = now_ns(clock_) - reply_.time_stamp();
+                            if (round_trips_++ >= config_.warmup)
+                            {
+                                rtt_.record(rtt);
+                            }
+                            return true;
+                        }
+                    }
+                    auto now = std::chrono::steady_clock::now();
+                    if (now >= deadline)
+                    {
+                        ++round_trips_;
+                        ++echoes_lost_;
+                        if (config_.live_stats_ms > 0)
+                        {
+                            live_window_.on_lost();
+                        }
+                        return false;
+                    }
+                    reply_reader_->wait_for_unread_message(
+                        Duration_t(std::chrono::duration<double>(deadline - now).count()));
+                }
+            }
+
+            //!Read, copy and write each frame in turn on the stream thread
+            void run_serial(
+                    MappedFrameSource& source)
+            {
+                Frame frame;
+                bool has_frame = false;
+
+                RateController pacer(config_.pacing);
+                // Printing every sample would dominate the measurement at full speed, or flood a soak test
+                const bool verbose = config_.verbose;
+                bool was_matched = false;
+                while ((pacer.unbounded() || samples_sent_ < config_.samples) && !pacer.finished())
+                {
+                    if (!ready_to_send(pacer, was_matched))
+                    {
+                        continue;
+                    }
+
+                    // A frame that could not be sent is retried on the next cycle
+                    if (!has_frame)
+                    {
+                        if (!source.next(frame))
+                        {
+                            std::cout << "Stream " << id_ << ": frame source exhausted after " << samples_sent_
+                                      << " samples" << std::endl;
+                            break;
+                        }
+                        has_frame = true;
+                        encoded_ = false;
+                    }
+
+                    pacer.wait();
+                    auto start = std::chrono::steady_clock::now();
+                    bool sent = mode_ == PublishMode::LOAN ? publish_loan(frame) : publish(frame);
+                    auto write_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now() - start).count();
+                    pacer.on_result(sent, static_cast<uint64_t>(write_ns));
+                    write_latency_.record(static_cast<uint64_t>(write_ns));
+                    if (sent)
+                    {
+                        has_frame = false;
+                        samples_sent_++;
+                        bytes_sent_ += frame.size;
+                        if (config_.live_stats_ms > 0)
+                        {
+                            live_window_.on_write(static_cast<uint64_t>(write_ns), frame.size);
+                        }
+                        if (verbose)
+                        {
+                            std::cout << "[" << minimal_.time_stamp() <<"] Stream " << id_ << " data with index: "
+                                      << minimal_.index() << " SENT" << std::endl;
+                        }
+                        if (reply_reader_ != nullptr)
+                        {
+                            await_echo(minimal_.index());
+                        }
+                    }
+                }
+            }
+
+            // Frames are read from the source and copied into one of config.pipeline
+            // slots by a producer thread, while the stream thread stamps and writes the
+            // filled ones. Slot indexes travel through two SPSC rings: free ones to the
+            // producer, filled ones to the writer, so neither side locks. In loan mode
+            // the producer fills DataWriter loans and the slot samples are only used
+            // when loans are not available.
+            void run_pipeline(
+                    MappedFrameSource& source)
+            {
+                const uint32_t depth = config_.pipeline;
+                slots_.assign(depth, Slot());
+                SpscRing<uint32_t> free_slots(depth);
+                SpscRing<uint32_t> ready_slots(depth);
+                // Minimal samples come from the stream's pool: with chunks the type is MinimalChunk
+                pool_.set_capacity(source.max_size());
+                for (uint32_t i = 0; i < depth; ++i)
+                {
+                    slots_[i].owned = mode_ == PublishMode::COPY ?
+                            static_cast<void*>(pool_.acquire()) : type_->create_data();
+                    free_slots.push(i);
+                }
+                stop_ = false;
+                exhausted_ = false;
+
+                std::thread producer([this, &source, &free_slots, &ready_slots]()
+                        {
+                            // Producers take the CPUs listed after those of the stream threads
+                            if (config_.cpus.size() >= 2 * static_cast<size_t>(config_.streams))
+                            {
+                                int cpu = config_.cpus[config_.streams + id_];
+                                if (!pin_current_thread(cpu))
+                                {
+                                    std::cout << "Stream " << id_ << ": cannot pin producer to CPU " << cpu << std::endl;
+                                }
+                            }
+                            produce(source, free_slots, ready_slots);
+                        });
+
+                RateController pacer(config_.pacing);
+                const bool verbose = config_.verbose;
+                bool was_matched = false;
+                uint32_t index = 0;
+                bool has_slot = false;
+                uint64_t starved = 0;
+                uint64_t occupancy = 0;
+                while ((pacer.unbounded() || samples_sent_ < config_.samples) && !pacer.finished())
+                {
+                    if (!ready_to_send(pacer, was_matched))
+                    {
+                        continue;
+                    }
+
+                    // A frame that could not be sent is retried on the next cycle
+                    if (!has_slot)
+                    {
+                        // Read before pop(): once exhausted, an empty ring stays empty
+                        bool exhausted = exhausted_.load(std::memory_order_acquire);
+                        occupancy += ready_slots.size();
+                        if (!ready_slots.pop(index))
+                        {
+                            if (exhausted)
+                            {
+                                std::cout << "Stream " << id_ << ": frame source exhausted after " << samples_sent_
+                                          << " samples" << std::endl;
+                                break;
+                            }
+                            ++starved;
+                            std::this_thread::yield();
+                            continue;
+                        }
+                        has_slot = true;
+                        queue_time_.add(elapsed_ns(slots_[index].ready));
+                    }
+
+                    pacer.wait();
+                    auto start = std::chrono::steady_clock::now();
+                    bool sent = write_slot(slots_[index]);
+                    uint64_t write_ns = elapsed_ns(start);
+                    pacer.on_result(sent, write_ns);
+                    write_latency_.record(write_ns);
+                    if (sent)
+                    {
+                        write_time_.add(write_ns);
+                        has_slot = false;
+                        samples_sent_++;
+                        bytes_sent_ += slots_[index].size;
+                        if (config_.live_stats_ms > 0)
+                        {
+                            live_window_.on_write(write_ns, slots_[index].size);
+                        }
+                        free_slots.push(index);
+                        if (verbose)
+                        {
+                            std::cout << "[" << minimal_.time_stamp() <<"] Stream " << id_ << " data with index: "
+                                      << minimal_.index() << " SENT" << std::endl;
+                        }
+                    }
+                }
+
+                stop_ = true;
+                producer.join();
+
+                // Loans still queued (or held for a retry) go back unsent
+                if (has_slot)
+                {
+                    release_slot(slots_[index]);
+                }
+                while (ready_slots.pop(index))
+                {
+                    release_slot(slots_[index]);
+                }
+                for (Slot& slot : slots_)
+                {
+                    if (mode_ == PublishMode::COPY)
+                    {
+                        pool_.release(static_cast<Minimal*>(slot.owned));
+                    }
+                    else
+                    {
+                        type_->delete_data(slot.owned);
+                    }
+                }
+                slots_.clear();
+
+                std::cout << "Stream " << id_ << " pipeline of " << depth << " buffers: average occupancy "
+                          << (write_time_.count + starved > 0 ?
+                        static_cast<double>(occupancy) / (write_time_.count + starved) : 0.0)
+                          << ", producer blocked " << producer_waits_ << " times, writer starved " << starved
+                          << " times" << std::endl;
+                std::cout << "  fill " << fill_time_.to_string() << " | queued " << queue_time_.to_string()
+                          << " | write " << write_time_.to_string() << std::endl;
+            }
+
+            //!Producer thread: fill free slots from the source until stopped or out of frames
+            void produce(
+                    MappedFrameSource& source,
+                    SpscRing<uint32_t>& free_slots,
+                    SpscRing<uint32_t>& ready_slots)
+            {
+                bool loans = mode_ == PublishMode::LOAN && !frame_;
+                bool waiting = false;
+                uint32_t index = 0;
+                while (!stop_)
+                {
+                    if (!free_slots.pop(index))
+                    {
+                        // The writer is behind: every buffer is filled
+                        producer_waits_ += waiting ? 0 : 1;
+                        waiting = true;
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    waiting = false;
+
+                    auto start = std::chrono::steady_clock::now();
+                    Slot& slot = slots_[index];
+                    Frame frame;
+                    if (!source.next(frame) || !fill(slot, frame, loans))
+                    {
+                        exhausted_.store(true, std::memory_order_release);
+                        return;
+                    }
+                    fill_time_.add(elapsed_ns(start));
+                    slot.ready = std::chrono::steady_clock::now();
+                    ready_slots.push(index);
+                }
+            }
+
+            //!Copy frame into a loan (when loans is set) or into the slot's own sample
+            bool fill(
+                    Slot& slot,
+                    const Frame& frame,
+                    bool& loans)
+            {
+                slot.size = static_cast<uint32_t>(frame.size);
+                if (mode_ == PublishMode::COPY)
+                {
+                    Minimal* minimal = static_cast<Minimal*>(slot.owned);
+                    minimal->stream_id(id_);
+                    minimal->codec(static_cast<uint8_t>(encoder_.encode(frame.data, frame.size, minimal->img_data())));
+                    minimal->raw_size(slot.size);
+                    slot.sample = minimal;
+                    slot.loaned = false;
+                    return true;
+                }
+
+                void* sample = nullptr;
+                while (loans)
+                {
+                    ReturnCode_t ret = writer_->loan_sample(sample);
+                    if (ret == RETCODE_OK)
+                    {
+                        break;
+                    }
+                    if (ret == RETCODE_ILLEGAL_OPERATION || ret == RETCODE_UNSUPPORTED)
+                    {
+                        std::cout << "DataWriter cannot loan samples (" << ret
+                                  << "). Falling back to copies." << std::endl;
+                        loans = false;
+                    }
+                    else if (stop_)
+                    {
+                        return false;
+                    }
+                    else
+                    {
+                        // Every loan is queued or in the writer history: wait for one to come back
+                        std::this_thread::yield();
+                    }
+                }
+
+                MinimalFrame* out = static_cast<MinimalFrame*>(loans ? sample : slot.owned);
+                std::memcpy(out->img_data().data(), frame.data, frame.size);
+                out->img_size(slot.size);
+                out->stream_id(id_);
+                slot.sample = out;
+                slot.loaned = loans;
+                return true;
+            }
+
+            //!Stamp and write a filled slot (stream thread)
+            bool write_slot(
+                    Slot& slot)
+            {
+                uint32_t index = minimal_.index() + 1;
+                uint64_t time_stamp = now_ns(clock_);
+                bool written = false;
+                if (mode_ == PublishMode::COPY)
+                {
+                    static_cast<Minimal*>(slot.sample)->index(index);
+                    static_cast<Minimal*>(slot.sample)->time_stamp(time_stamp);
+                    written = write_frame(*static_cast<Minimal*>(slot.sample));
+                }
+                else
+                {
+                    static_cast<MinimalFrame*>(slot.sample)->index(index);
+                    static_cast<MinimalFrame*>(slot.sample)->time_stamp(time_stamp);
+                    written = writer_->write(slot.sample) == RETCODE_OK;
+                }
+                if (!written)
+                {
+                    return false;
+                }
+                // A written loan belongs to the DataWriter again
+                slot.sample = nullptr;
+                slot.loaned = false;
+                minimal_.index(index);
+                minimal_.time_stamp(time_stamp);
+                return true;
+            }
+
+            void release_slot(
+                    Slot& slot)
+            {
+                if (slot.loaned)
+                {
+                    writer_->discard_loan(slot.sample);
+                    slot.loaned = false;
+                }
+                slot.sample = nullptr;
+            }
+
+            uint32_t id_;
+            const MinimalConfig& config_;
+            PublishMode mode_;
+            ClockDomain clock_;
+            FrameEncoder encoder_;                  // Used by the thread that fills the samples
+            Minimal minimal_;
+            bool encoded_;                          // minimal_ holds the current frame (copy mode, no pipeline)
+            MinimalChunk chunk_;                    // Chunk being written (config.chunk_size > 0)
+            std::unique_ptr<MinimalFrame> frame_;   // Only used when loans are not available
+            DataWriter* writer_;
+            PubListener listner_;
+            uint64_t samples_sent_;
+            uint64_t bytes_sent_;
+            LatencyHistogram write_latency_;
+            SendWindow live_window_;
+
+            // Ping state (config.ping)
+            DataReader* reply_reader_;
+            ReplyListener reply_listener_;
+            Minimal reply_;
+            LatencyHistogram rtt_;
+            uint64_t round_trips_;                  // Echoed or lost, warmup included
+            uint64_t echoes_lost_;
+            std::chrono::steady_clock::time_point start_;
+            std::chrono::steady_clock::time_point end_;
+
+            // Pipeline state (config.pipeline > 0)
+            TypeSupport type_;
+            FramePool pool_;                        // Minimal samples of the copy mode slots
+            std::vector<Slot> slots_;
+            std::atomic<bool> stop_;
+            std::atomic<bool> exhausted_;
+            uint64_t producer_waits_;
+            StageTime fill_time_;                   // Producer: source + copy into the buffer
+            StageTime queue_time_;                  // Filled buffer waiting for the writer
+            StageTime write_time_;                  // Writer: stamp + write()
+    };
+
+        MinimalConfig config_;
+        DomainParticipant* participant_;
+        Publisher* publisher_;
+        Subscriber* subscriber_;                // Ping only: echo readers
+        TypeSupport type_;
+        std::vector<Topic*> topics_;
+        std::vector<Topic*> reply_topics_;
+        std::vector<std::unique_ptr<Stream>> streams_;
+        LiveStatsPublisher live_;
 
     public:
-        MinimalPublisher()
-            : participant_(nullptr)
+        MinimalPublisher(
+                const MinimalConfig& config)
+            : config_(config)
+            , participant_(nullptr)
             , publisher_(nullptr)
-            , topic_(nullptr)
-            , writer_(nullptr)
-            , type_(new MinimalPubSubType())
+            , subscriber_(nullptr)
+            , type_(config.loan ?
+                    static_cast<TopicDataType*>(new MinimalFrameFastPubSubType()) :
+                    config.chunked() ?
+                    static_cast<TopicDataType*>(new MinimalChunkFastPubSubType()) :
+                    static_cast<TopicDataType*>(new MinimalFastPubSubType()))
+            , live_(LiveStatsPublisher::PUBLISHER, config.clock)
         {
         }
 
         virtual ~MinimalPublisher()
         {
-            if (writer_ != nullptr)
+            for (auto& stream : streams_)
             {
-                publisher_->delete_datawriter(writer_);
+                stream->destroy(publisher_, subscriber_);
             }
             if (publisher_ != nullptr)
             {
                 participant_->delete_publisher(publisher_);
             }
-            if (topic_ != nullptr)
+            if (subscriber_ != nullptr)
             {
-                participant_->delete_topic(topic_);
+                participant_->delete_subscriber(subscriber_);
             }
+            for (Topic* topic : topics_)
+            {
+                participant_->delete_topic(topic);
+            }
+            for (Topic* topic : reply_topics_)
+            {
+                participant_->delete_topic(topic);
+            }
+            live_.destroy();
             DomainParticipantFactory::get_instance()->delete_participant(participant_);
         }
 
         //!Initialize the publisher
         bool init()
         {
-            // Explicitly create the shared memory transport
-            DomainParticipantQos pqos = PARTICIPANT_QOS_DEFAULT;
-            pqos.name("Participant_pub");
-            pqos.transport().use_builtin_transports = false;
-
-            #if SHM_TRANSPORT
-            std::shared_ptr<SharedMemTransportDescriptor> shm_transport =
-                    std::make_shared<SharedMemTransportDescriptor>();
-            shm_transport->segment_size(SHM_SEGMENT_SIZE);                  // Tuned:10 images of 1920x1280 pixels
-            
-            pqos.transport().user_transports.push_back(shm_transport);
-            #endif
-
-            #if UDP_TRANSPORT
-            auto udp_transport = std::make_shared<UDPv4TransportDescriptor>();
-            udp_transport->sendBufferSize = UDP_BUF_SIZE;
-            udp_transport->receiveBufferSize = UDP_BUF_SIZE;
-            udp_transport->non_blocking_send = true;
-            pqos.transport().user_transports.push_back(udp_transport);
-            #endif
-
-            #if LARGE_TRANSPORT
-            pqos.transport().use_builtin_transports = true;
-            pqos.setup_transports(BuiltinTransports::LARGE_DATA);
-            #endif  
-
-            minimal_.index(0);
-            minimal_.time_stamp(0);
-            // minimal_.img_data(NULL);
-            
-            // Create the participant
-            participant_ = DomainParticipantFactory::get_instance()->create_participant(0, pqos);
+            // Explicitly create the configured transport
+            DomainParticipantQos pqos = make_participant_qos(config_, "Participant_pub");
+
+            // Create the participant, shared by every stream
+            participant_ = DomainParticipantFactory::get_instance()->create_participant(config_.domain, pqos);
 
             if (participant_ == nullptr)
             {
@@ -156,10 +1025,7 @@ class MinimalPublisher
             // Register the type
             type_.register_type(participant_);
 
-            // Create the publications Topic
-            topic_ = participant_->create_topic("MinimalTopic", "Minimal", TOPIC_QOS_DEFAULT);
-
-            if (topic_ == nullptr)
+            if (config_.live_stats_ms > 0 && !live_.init(participant_))
             {
                 return false;
             }
@@ -172,119 +1038,219 @@ class MinimalPublisher
                 return false;
             }
 
-            // Create the DataWriter
-            #if SHM_TRANSPORT
-            DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
-            publisher_->get_default_datawriter_qos(writer_qos);
-            writer_qos.reliability().kind = ReliabilityQosPolicyKind::RELIABLE_RELIABILITY_QOS;
-            writer_qos.durability().kind = DurabilityQosPolicyKind::TRANSIENT_LOCAL_DURABILITY_QOS;
-            writer_qos.history().kind = HistoryQosPolicyKind::KEEP_LAST_HISTORY_QOS;
-            writer_qos.data_sharing().automatic();
-            #endif
-
-            writer_ = publisher_->create_datawriter(topic_, writer_qos, &listner_);
+            // Echoes come back as Minimal samples, the frame type already unless frames are loaned or chunked
+            TypeSupport reply_type = config_.loan || config_.chunked() ?
+                    TypeSupport(new MinimalFastPubSubType()) : type_;
+            if (config_.ping)
+            {
+                reply_type.register_type(participant_);
+                subscriber_ = participant_->create_subscriber(SUBSCRIBER_QOS_DEFAULT, nullptr);
+                if (subscriber_ == nullptr)
+                {
+                    return false;
+                }
+            }
 
-            if (writer_ == nullptr)
+            for (uint32_t i = 0; i < config_.streams; ++i)
             {
-                return false;
+                // Frames go on their own topic, the types differ
+                if (i == 0 || !config_.keyed)
+                {
+                    Topic* topic = participant_->create_topic(config_.topic_name(i), type_.get_type_name(),
+                                    TOPIC_QOS_DEFAULT);
+                    if (topic == nullptr)
+                    {
+                        return false;
+                    }
+                    topics_.push_back(topic);
+                    if (config_.ping)
+                    {
+                        Topic* reply_topic = participant_->create_topic(config_.reply_topic_name(i),
+                                        reply_type.get_type_name(), TOPIC_QOS_DEFAULT);
+                        if (reply_topic == nullptr)
+                        {
+                            return false;
+                        }
+                        reply_topics_.push_back(reply_topic);
+                    }
+                }
+
+                streams_.emplace_back(new Stream(i, config_));
+                if (!streams_.back()->init(publisher_, topics_.back(), type_, subscriber_,
+                        config_.ping ? reply_topics_.back() : nullptr))
+                {
+                    return false;
+                }
             }
             return true;
         }
 
-        //!Send a publication
-        bool publish(std::ifstream& file, size_t size)
+        //!Run the Publisher: one thread per stream
+        void run()
         {
-            // Allocate memory for the data
-            minimal_.img_data().resize(size);
-            file.read((char*)minimal_.img_data().data(), size);
-            struct timeval tv;
-
-            if (listner_.matched_ > 0)
+            std::vector<std::thread> threads;
+            for (auto& stream : streams_)
             {
-                minimal_.index(minimal_.index() + 1);
-                gettimeofday(&tv, NULL);
-                auto time = tv.tv_usec;
-                minimal_.time_stamp(time);
-                writer_->write(&minimal_);
-                return true;
+                Stream* s = stream.get();
+                threads.emplace_back([this, s]()
+                        {
+                            if (!config_.cpus.empty())
+                            {
+                                int cpu = config_.cpus[s->id() % config_.cpus.size()];
+                                if (!pin_current_thread(cpu))
+                                {
+                                    std::cout << "Stream " << s->id() << ": cannot pin to CPU " << cpu << std::endl;
+                                }
+                            }
+                            s->run();
+                        });
+            }
+            std::atomic<bool> done(false);
+            std::thread stats;
+            if (config_.live_stats_ms > 0)
+            {
+                stats = std::thread([this, &done]()
+                                {
+                                    publish_live_stats(done);
+                                });
+            }
+            for (std::thread& thread : threads)
+            {
+                thread.join();
+            }
+            if (stats.joinable())
+            {
+                done = true;
+                stats.join();
             }
-            return false;
-        }
-
-        //!Run the Publisher
-        void run(uint32_t samples)
-        {
-            uint32_t samples_sent = 0;
-            
-            #if IMG_TRANSFER
-            // const std::string path = "/home/dungrup/ext-vol/fastdds-minimal-sample/src/img.png";
-            const std::string path = "../src/img.png";
-            #else
-            // const std::string path = "/home/dungrup/ext-vol/fastdds-minimal-sample/src/dummy.bin";
-            const std::string path = "./dummy.bin";
-            #endif
 
-            // Read the image data from the file
-            std::ifstream file(path);
-            if (!file.is_open())
+            if (streams_.size() > 1)
             {
-                std::cout << "Error opening file" << std::endl;
+                uint64_t samples = 0;
+                uint64_t bytes = 0;
+                double seconds = 0;
+                for (auto& stream : streams_)
+                {
+                    std::cout << "Stream " << stream->id() << ": " << stream->samples_sent() << " samples, "
+                              << (stream->seconds() > 0 ? stream->bytes_sent() / stream->seconds() / 1e6 : 0.0)
+                              << " MB/s" << std::endl;
+                    samples += stream->samples_sent();
+                    bytes += stream->bytes_sent();
+                    seconds = std::max(seconds, stream->seconds());
+                }
+                std::cout << "Aggregate: " << streams_.size() << " streams, " << samples << " samples, "
+                          << (seconds > 0 ? samples / seconds : 0.0) << " samples/s, "
+                          << (seconds > 0 ? bytes / seconds / 1e6 : 0.0) << " MB/s" << std::endl;
             }
 
-            file.seekg(0, std::ios::end);
-            size_t size = file.tellg();
-            file.seekg(0, std::ios::beg);
-            
-            while (samples_sent < samples)
+            if (!config_.report.empty())
             {
-                if (publish(file, size))
+                CodecStats codec;
+                LatencyHistogram write_latency;
+                LatencyHistogram round_trip;
+                uint64_t samples = 0;
+                uint64_t echoes_lost = 0;
+                for (auto& stream : streams_)
                 {
-                    samples_sent++;
-                    std::cout << "[" << minimal_.time_stamp() <<"] Data with index: " << minimal_.index()
-                                << " SENT" << std::endl;
+                    codec.merge(stream->codec_stats());
+                    write_latency.merge(stream->write_latency());
+                    round_trip.merge(stream->round_trip());
+                    samples += stream->samples_sent();
+                    echoes_lost += stream->echoes_lost();
+                }
+                std::ofstream report(config_.report);
+                report << "{\"streams\": " << streams_.size() << ", \"samples_sent\": " << samples
+                       << ", \"publish_mode\": \"" << (config_.flow.async ? "async" : "sync") << "\""
+                       << ", \"write_mean_ns\": " << static_cast<uint64_t>(write_latency.mean())
+                       << ", \"write_p50_ns\": " << write_latency.value_at_percentile(50)
+                       << ", \"write_p99_ns\": " << write_latency.value_at_percentile(99)
+                       << ", \"write_max_ns\": " << write_latency.max();
+                if (config_.ping)
+                {
+                    report << ", \"rtt_samples\": " << round_trip.count() << ", \"rtt_lost\": " << echoes_lost
+                           << ", \"rtt_min_ns\": " << round_trip.min()
+                           << ", \"rtt_p50_ns\": " << round_trip.value_at_percentile(50)
+                           << ", \"rtt_p90_ns\": " << round_trip.value_at_percentile(90)
+                           << ", \"rtt_p99_ns\": " << round_trip.value_at_percentile(99)
+                           << ", \"rtt_max_ns\": " << round_trip.max();
+                }
+                report << ", \"codec\": \"" << codec_name(streams_.empty() ? Codec::NONE : streams_[0]->codec())
+                       << "\", \"compression\": " << codec.to_json("encode") << "}" << std::endl;
+                if (!report)
+                {
+                    std::cout << "Error writing " << config_.report << std::endl;
                 }
-                std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_TIME_MS));
             }
+        }
 
-            file.close();
+    private:
+
+        //!Stats thread: every config.live_stats_ms, merge the windows of the streams and publish them,
+        //!once more for the last period when done is set
+        void publish_live_stats(
+                const std::atomic<bool>& done)
+        {
+            const auto period = std::chrono::milliseconds(config_.live_stats_ms);
+            auto start = std::chrono::steady_clock::now();
+            bool last = false;
+            while (!last)
+            {
+                // Short sleeps so that the end of the run is seen quickly
+                auto deadline = start + period;
+                while (!(last = done.load()) && std::chrono::steady_clock::now() < deadline)
+                {
+                    std::this_thread::sleep_for(std::min<std::chrono::steady_clock::duration>(
+                                deadline - std::chrono::steady_clock::now(), std::chrono::milliseconds(100)));
+                }
+                auto now = std::chrono::steady_clock::now();
+                SendCounts counts;
+                uint32_t matched = 0;
+                for (auto& stream : streams_)
+                {
+                    stream->live_window().drain_into(counts);
+                    matched += stream->matched();
+                }
+                live_.publish(counts.report(std::chrono::duration<double>(now - start).count()), matched);
+                start = now;
+            }
         }
 };
 
 int main(int argc, char** argv)
 {
     std::cout << "Starting MinimalPublisher" << std::endl;
-    int samples = 10;
 
-    
-    // Create a dummy buffer and write it to a file
-    // std::ofstream file("/home/dungrup/ext-vol/fastdds-minimal-sample/src/dummy.bin", std::ios::binary);
-    std::ofstream file("./dummy.bin", std::ios::binary);
-    if (file.is_open())
+    MinimalConfig config;
+    if (!parse_options(argc, argv, config))
     {
-        std::vector<uint8_t> buffer(DATA_SIZE, 0);
-        std::iota(buffer.begin(), buffer.end(), 0);
-        
-        std::cout << "Buffer contents:\n";
-        for (size_t i = 0; i < 512; ++i) {
-            std::cout << static_cast<int>(buffer[i]) << " ";
-            if ((i + 1) % 16 == 0) std::cout << '\n';  // Optional: print 16 per line
-        }
-
-        file.write((char*)buffer.data(), DATA_SIZE);
-        file.close();
+        return 1;
     }
-    else
+    std::cout << "QoS: " << config.qos_summary() << std::endl;
+
+    if (config.file.empty())
     {
-        std::cout << "Error creating dummy file" << std::endl;
+        // Create a dummy buffer and write it to a file
+        // std::ofstream file("/home/dungrup/ext-vol/fastdds-minimal-sample/src/dummy.bin", std::ios::binary);
+        std::ofstream file("./dummy.bin", std::ios::binary);
+        if (file.is_open())
+        {
+            std::vector<uint8_t> buffer(config.data_size, 0);
+            std::iota(buffer.begin(), buffer.end(), 0);
+            file.write((char*)buffer.data(), buffer.size());
+            file.close();
+        }
+        else
+        {
+            std::cout << "Error creating dummy file" << std::endl;
+        }
     }
-    
 
-    MinimalPublisher* mypub = new MinimalPublisher();
+    MinimalPublisher* mypub = new MinimalPublisher(config);
     if (mypub->init())
     {
-        mypub->run(samples);
+        mypub->run();
     }
 
     delete mypub;
     return 0;
-}
\ No newline at end of file
+}
@@ -2,17 +2,32 @@
 // Inspired by the HelloWorld example from FastDDS 
 
 #include "MinimalPubSubTypes.hpp"
-
+#include "minimal_fast_types.hpp"
+#include "frame_reassembler.hpp"
+#include "latency_recorder.hpp"
+#include "live_stats.hpp"
+#include "minimal_clock.hpp"
+#include "minimal_config.hpp"
+#include "receive_stats.hpp"
+
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <mutex>
 #include <thread>
 #include <fstream>
-#include <sys/time.h>
 #include <time.h>
 
+#include <fastdds/dds/core/LoanableSequence.hpp>
+#include <fastdds/dds/core/condition/WaitSet.hpp>
 #include <fastdds/dds/domain/DomainParticipant.hpp>
 #include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/publisher/qos/DataWriterQos.hpp>
 #include <fastdds/dds/subscriber/DataReader.hpp>
 #include <fastdds/dds/subscriber/DataReaderListener.hpp>
+#include <fastdds/dds/subscriber/ReadCondition.hpp>
 #include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
 #include <fastdds/dds/subscriber/SampleInfo.hpp>
 #include <fastdds/dds/subscriber/Subscriber.hpp>
@@ -24,15 +39,18 @@
 #include <fastdds/rtps/transport/UDPv4TransportDescriptor.hpp>
 #include <fastdds/rtps/transport/UDPv6TransportDescriptor.hpp>
 
-#define SHM_SEGMENT_SIZE 1920*1280*10   // Tuned:10 images of 1920x1280 pixels
-#define UDP_BUF_SIZE 1920*1280*10
-#define SHM_TRANSPORT 1         // Uses data sharing as well (check rqos.data_sharing().automatic();) 
-#define UDP_TRANSPORT 0
-#define LARGE_TRANSPORT 0
-
 using namespace eprosima::fastdds::dds;
 using namespace eprosima::fastdds::rtps;
 
+FASTDDS_SEQUENCE(MinimalSeq, Minimal);
+FASTDDS_SEQUENCE(MinimalFrameSeq, MinimalFrame);
+
+enum class ReceiveMode
+{
+    COPY,       // Minimal samples deserialized by take_next_sample(), or by take() with a take batch
+    LOAN,       // MinimalFrame samples loaned by take() and processed in place
+    CHUNK       // MinimalChunk samples reassembled into frames
+};
 
 class MinimalSubscriber
 {
@@ -42,15 +60,57 @@ class MinimalSubscriber
         DataReader* reader_;
         Topic* topic_;
         TypeSupport type_;
+        MinimalConfig config_;
+        Publisher* publisher_;          // Echo only
+        Topic* reply_topic_;
+        std::atomic<bool> stop_;
+        uint64_t waits_;                // Receive thread: WaitSet waits
+        uint64_t empty_polls_;          // Receive thread: takes that found nothing
+        LiveStatsPublisher live_;
 
     class SubListener : public DataReaderListener
     {
         public:
 
+            // Counters of the take path, see counters()
+            struct Counters
+            {
+                BatchStats batches;
+                CodecStats codec;
+                ReassemblyStats reassembly;
+                uint64_t echoed = 0;
+                uint64_t echo_failures = 0;
+            };
+
             Minimal minimal_;
+            MinimalChunk chunk_;
+            ReceiveMode mode_;
+            ClockDomain clock_;
+            LatencyRecorder recorder_;
+            ReceiveStats stats_;
+            std::unique_ptr<FrameDecoder> decoder_;
+            std::unique_ptr<FrameReassembler> reassembler_;     // Chunk mode only
+            uint32_t take_batch_;
+            BatchStats batches_;
+            std::mutex take_mutex_;                             // Held while taking: the listener may still take
+                                                                // while run() reports, see counters()
+            DataWriter* echo_writer_;                           // Echo only
+            bool echo_header_only_;
+            Minimal reply_;                                     // Echo of a frame that is not a Minimal sample
+            uint64_t echoed_;
+            uint64_t echo_failures_;
+            bool print_samples_;                                // One console line per frame (--verbose)
             std::atomic_int samples_;
             SubListener()
-                : samples_(0)
+                : mode_(ReceiveMode::COPY)
+                , clock_(ClockDomain::MONOTONIC)
+                , take_batch_(0)
+                , echo_writer_(nullptr)
+                , echo_header_only_(false)
+                , echoed_(0)
+                , echo_failures_(0)
+                , print_samples_(false)
+                , samples_(0)
             {
             }
 
@@ -80,44 +140,292 @@ class MinimalSubscriber
             void on_data_available(
                     DataReader* reader) override
             {
+                take_available(reader);
+            }
+
+            //!Take and process what the reader has (one sample in copy mode), returns the samples taken
+            uint32_t take_available(
+                    DataReader* reader)
+            {
+                std::lock_guard<std::mutex> guard(take_mutex_);
+                if (mode_ == ReceiveMode::LOAN)
+                {
+                    return take_loaned(reader);
+                }
+                if (mode_ == ReceiveMode::CHUNK)
+                {
+                    return take_chunks(reader);
+                }
+                if (take_batch_ > 0)
+                {
+                    return take_batched(reader);
+                }
+
+                SampleInfo info;
+                if (reader->take_next_sample(&minimal_, &info) != eprosima::fastdds::dds::RETCODE_OK)
+                {
+                    return 0;
+                }
+                if (info.valid_data && echo_writer_ != nullptr)
+                {
+                    echo(minimal_);
+                }
+                // Compressed frames are decoded before the sample counts as received
+                if (info.valid_data && decode(minimal_.codec(), minimal_.img_data().data(),
+                        minimal_.img_data().size(), minimal_.raw_size()))
+                {
+                    on_sample(info.publication_handle, minimal_.index(),
+                            minimal_.time_stamp(), minimal_.codec() != 0 ? minimal_.raw_size() :
+                            static_cast<uint32_t>(minimal_.img_data().size()));
+
+                    // Save the image data to a file
+                    // std::string filename = "/home/dungrup/ext-vol/dds_ws/dest_dir/received_image_" + std::to_string(minimal_.index()) + ".png";
+
+                    // std::ofstream file(filename, std::ios::binary);
+                    // file.write((char*)minimal_.img_data().data(), minimal_.img_data().size());
+                    // file.close();
+                }
+                return 1;
+            }
+
+            //!Drain the reader take_batch_ samples at a time, each batch loaned from the reader's sample pool
+            uint32_t take_batched(
+                    DataReader* reader)
+            {
+                uint32_t taken = 0;
+                MinimalSeq samples;
+                SampleInfoSeq infos;
+                while (reader->take(samples, infos, static_cast<int32_t>(take_batch_)) ==
+                        eprosima::fastdds::dds::RETCODE_OK)
+                {
+                    const uint32_t count = static_cast<uint32_t>(samples.length());
+                    on_take(count);
+                    for (LoanableCollection::size_type i = 0; i < samples.length(); ++i)
+                    {
+                        const Minimal& sample = samples[i];
+                        if (infos[i].valid_data && echo_writer_ != nullptr)
+                        {
+                            echo(sample);
+                        }
+                        if (infos[i].valid_data && decode(sample.codec(), sample.img_data().data(),
+                                sample.img_data().size(), sample.raw_size()))
+                        {
+                            on_sample(infos[i].publication_handle, sample.index(),
+                                    sample.time_stamp(), sample.codec() != 0 ? sample.raw_size() :
+                                    static_cast<uint32_t>(sample.img_data().size()));
+                        }
+                    }
+                    reader->return_loan(samples, infos);
+                    taken += count;
+                }
+                return taken;
+            }
+
+            //!Take the available frames as loans (take_batch_ at a time if set), process them in place
+            //!and give them back to the reader
+            uint32_t take_loaned(
+                    DataReader* reader)
+            {
+                uint32_t taken = 0;
+                MinimalFrameSeq frames;
+                SampleInfoSeq infos;
+                while (reader->take(frames, infos, take_batch_ > 0 ? static_cast<int32_t>(take_batch_) :
+                        LENGTH_UNLIMITED) == eprosima::fastdds::dds::RETCODE_OK)
+                {
+                    const uint32_t count = static_cast<uint32_t>(frames.length());
+                    on_take(count);
+                    for (LoanableCollection::size_type i = 0; i < frames.length(); ++i)
+                    {
+                        if (infos[i].valid_data)
+                        {
+                            // frames[i] points into the data-sharing segment: nothing has been copied
+                            const MinimalFrame& frame = frames[i];
+                            if (echo_writer_ != nullptr)
+                            {
+                                echo(frame.stream_id(), frame.index(), frame.time_stamp(), frame.img_data().data(),
+                                        frame.img_size());
+                            }
+                            on_sample(infos[i].publication_handle, frame.index(),
+                                    frame.time_stamp(), frame.img_size());
+                        }
+                    }
+                    reader->return_loan(frames, infos);
+                    taken += count;
+                }
+                return taken;
+            }
+
+            //!Take every available chunk, a frame counts as received once its last chunk is in
+            uint32_t take_chunks(
+                    DataReader* reader)
+            {
+                uint32_t taken = 0;
                 SampleInfo info;
-                struct timeval time_val;
-                if (reader->take_next_sample(&minimal_, &info) == eprosima::fastdds::dds::RETCODE_OK)
+                while (reader->take_next_sample(&chunk_, &info) == eprosima::fastdds::dds::RETCODE_OK)
                 {
-                    if (info.valid_data)
+                    ++taken;
+                    if (!info.valid_data)
+                    {
+                        continue;
+                    }
+                    const ChunkedFrame* frame = reassembler_->add(chunk_, now_ns(clock_));
+                    if (frame != nullptr && echo_writer_ != nullptr)
+                    {
+                        echo(frame->stream_id, frame->index, frame->time_stamp, frame->data.data(), frame->data.size());
+                    }
+                    if (frame != nullptr && decode(frame->codec, frame->data.data(), frame->data.size(),
+                            frame->raw_size))
                     {
-                        samples_++;
-                        gettimeofday(&time_val, NULL);
-                        unsigned long now = time_val.tv_usec;
-                        auto latency = (now - minimal_.time_stamp()) / 1000.0;
-                        std::cout << "[" << minimal_.time_stamp() <<"] Image with index: " << minimal_.index()
-                                  << " RECEIVED, latency: " << latency << " ms" << std::endl;
-                        
-                        // Save the image data to a file
-                        // std::string filename = "/home/dungrup/ext-vol/dds_ws/dest_dir/received_image_" + std::to_string(minimal_.index()) + ".png";
-
-                        // std::ofstream file(filename, std::ios::binary);
-                        // file.write((char*)minimal_.img_data().data(), minimal_.img_data().size());
-                        // file.close();
-
-                        // Save the latency to a file
-                        std::ofstream latency_file_;
-                        latency_file_.open("latency.csv", std::ofstream::out | std::ofstream::app);
-                        latency_file_ << now << "," << minimal_.time_stamp() << std::endl;
-                        latency_file_.close();
+                        // Attributed to the writer of the chunk that completed the frame
+                        on_sample(info.publication_handle, frame->index, frame->time_stamp,
+                                frame->codec != 0 ? frame->raw_size : static_cast<uint32_t>(frame->data.size()));
                     }
                 }
+                return taken;
+            }
+
+            void on_take(
+                    uint32_t count)
+            {
+                batches_.on_take(count);
+            }
+
+            //!Copy of the counters updated by the take path, consistent with each other
+            Counters counters()
+            {
+                std::lock_guard<std::mutex> guard(take_mutex_);
+                Counters counters;
+                counters.batches = batches_;
+                counters.codec = decoder_->stats();
+                if (reassembler_)
+                {
+                    counters.reassembly = reassembler_->stats();
+                }
+                counters.echoed = echoed_;
+                counters.echo_failures = echo_failures_;
+                return counters;
+            }
+
+            //!Republish sample on the reply topic as received (header only if so configured)
+            void echo(
+                    const Minimal& sample)
+            {
+                if (echo_header_only_)
+                {
+                    echo(sample.stream_id(), sample.index(), sample.time_stamp(), nullptr, 0);
+                    return;
+                }
+                ++(echo_writer_->write(&sample) == eprosima::fastdds::dds::RETCODE_OK ? echoed_ : echo_failures_);
+            }
+
+            //!Republish a frame received as a MinimalFrame or as chunks, as a Minimal sample
+            void echo(
+                    uint32_t stream_id,
+                    uint32_t index,
+                    uint64_t time_stamp,
+                    const uint8_t* data,
+                    size_t size)
+            {
+                reply_.stream_id(stream_id);
+                reply_.index(index);
+                reply_.time_stamp(time_stamp);
+                reply_.codec(0);
+                reply_.raw_size(static_cast<uint32_t>(size));
+                if (echo_header_only_ || size == 0)
+                {
+                    reply_.img_data().clear();
+                }
+                else
+                {
+                    reply_.img_data().assign(data, data + size);
+                }
+                ++(echo_writer_->write(&reply_) == eprosima::fastdds::dds::RETCODE_OK ? echoed_ : echo_failures_);
+            }
+
+            //!Decode a frame that may be compressed, false (reported once) if it cannot be
+            bool decode(
+                    uint8_t codec,
+                    const uint8_t* data,
+                    size_t size,
+                    uint32_t raw_size)
+            {
+                if (decoder_->decode(codec, data, size, raw_size) != nullptr)
+                {
+                    return true;
+                }
+                if (decoder_->stats().failed == 1)
+                {
+                    std::cout << "Cannot decode " << codec_name(static_cast<Codec>(codec))
+                              << " frames, dropping them" << std::endl;
+                }
+                return false;
+            }
+
+            //!Account for a received sample
+            void on_sample(
+                    const InstanceHandle_t& writer,
+                    uint32_t index,
+                    uint64_t time_stamp,
+                    uint32_t size)
+            {
+                samples_++;
+                uint64_t now = now_ns(clock_);
+                // Signed on purpose: a negative value exposes clocks that are not comparable
+                int64_t latency_ns = static_cast<int64_t>(now - time_stamp);
+                if (print_samples_)
+                {
+                    double latency = latency_ns / 1e6;
+                    std::cout << "[" << time_stamp <<"] Image with index: " << index
+                              << " RECEIVED, latency: " << latency << " ms" << std::endl;
+                }
+
+                // Queued in memory, written to disk by the recorder thread
+                recorder_.record({now, time_stamp, index, size});
+                stats_.on_sample(writer, index, latency_ns, size, now);
             }
     }listener_;
 
     public:
-        MinimalSubscriber()
+        MinimalSubscriber(
+                const MinimalConfig& config)
             : participant_(nullptr)
             , subscriber_(nullptr)
             , reader_(nullptr)
             , topic_(nullptr)
-            , type_(new MinimalPubSubType())
+            , type_(config.loan ?
+                    static_cast<TopicDataType*>(new MinimalFrameFastPubSubType()) :
+                    config.chunked() ?
+                    static_cast<TopicDataType*>(new MinimalChunkFastPubSubType()) :
+                    static_cast<TopicDataType*>(new MinimalFastPubSubType()))
+            , config_(config)
+            , publisher_(nullptr)
+            , reply_topic_(nullptr)
+            , stop_(false)
+            , waits_(0)
+            , empty_polls_(0)
+            , live_(LiveStatsPublisher::SUBSCRIBER, config.clock)
         {
+            listener_.mode_ = config.loan ? ReceiveMode::LOAN :
+                    config.chunked() ? ReceiveMode::CHUNK : ReceiveMode::COPY;
+            listener_.clock_ = config.clock;
+            listener_.take_batch_ = config.take_batch;
+            listener_.echo_header_only_ = config.echo_header_only;
+            listener_.print_samples_ = config.verbose;
+            listener_.decoder_.reset(new FrameDecoder(config.compression, config.frame_limit()));
+            if (listener_.mode_ == ReceiveMode::CHUNK)
+            {
+                // Room for a couple of frames per stream in flight, every buffer allocated here
+                uint32_t slots = std::max<uint32_t>(4, 2 * (config.keyed ? config.streams : 1));
+                listener_.chunk_.data().reserve(config.chunk_size);
+                listener_.reassembler_.reset(new FrameReassembler(slots, config.data_size, config.chunk_size,
+                        config.frame_limit(), static_cast<uint64_t>(config.frame_deadline_ms) * 1000000));
+            }
+            else if (!config.loan)
+            {
+                // Frames up to data_size are copied into buffers reserved once, never reallocated
+                FramePool::reserve(listener_.minimal_, config.data_size);
+                pool().set_capacity(config.data_size);
+            }
         }
 
         virtual ~MinimalSubscriber()
@@ -126,6 +434,19 @@ class MinimalSubscriber
             {
                 subscriber_->delete_datareader(reader_);
             }
+            if (listener_.echo_writer_ != nullptr)
+            {
+                publisher_->delete_datawriter(listener_.echo_writer_);
+            }
+            if (publisher_ != nullptr)
+            {
+                participant_->delete_publisher(publisher_);
+            }
+            if (reply_topic_ != nullptr)
+            {
+                participant_->delete_topic(reply_topic_);
+            }
+            live_.destroy();
             if (topic_ != nullptr)
             {
                 participant_->delete_topic(topic_);
@@ -140,34 +461,17 @@ class MinimalSubscriber
         // Init subscriber
         bool init()
         {
-            // Explicitly create the shared memory transport
-            DomainParticipantQos pqos = PARTICIPANT_QOS_DEFAULT;
-            pqos.name("Participant_subscriber");
-            pqos.transport().use_builtin_transports = false;
-
-            #if SHM_TRANSPORT
-            std::shared_ptr<SharedMemTransportDescriptor> shm_transport =
-                    std::make_shared<SharedMemTransportDescriptor>();
-            shm_transport->segment_size(SHM_SEGMENT_SIZE);               
-            
-            pqos.transport().user_transports.push_back(shm_transport);
-            #endif
-
-            #if UDP_TRANSPORT
-            auto udp_transport = std::make_shared<UDPv4TransportDescriptor>();
-            udp_transport->sendBufferSize = UDP_BUF_SIZE;
-            udp_transport->receiveBufferSize = UDP_BUF_SIZE;
-            udp_transport->non_blocking_send = true;
-            pqos.transport().user_transports.push_back(udp_transport);
-            #endif
-
-            #if LARGE_TRANSPORT
-            pqos.transport().use_builtin_transports = true;
-            pqos.setup_transports(BuiltinTransports::LARGE_DATA);
-            #endif  
-            
+            if (!listener_.recorder_.start("latency.bin"))
+            {
+                std::cout << "Error opening latency.bin" << std::endl;
+                return false;
+            }
+
+            // Explicitly create the configured transport
+            DomainParticipantQos pqos = make_participant_qos(config_, "Participant_subscriber");
+
             // Create the participant
-            participant_ = DomainParticipantFactory::get_instance()->create_participant(0, pqos);
+            participant_ = DomainParticipantFactory::get_instance()->create_participant(config_.domain, pqos);
 
             if (participant_ == nullptr)
             {
@@ -178,7 +482,8 @@ class MinimalSubscriber
             type_.register_type(participant_);
 
             // Create the subscriptions Topic
-            topic_ = participant_->create_topic("MinimalTopic", "Minimal", TOPIC_QOS_DEFAULT);
+            topic_ = participant_->create_topic(
+                config_.topic_name(config_.stream), type_.get_type_name(), TOPIC_QOS_DEFAULT);
 
             if (topic_ == nullptr)
             {
@@ -193,45 +498,305 @@ class MinimalSubscriber
                 return false;
             }
 
+            if (config_.live_stats_ms > 0 && !live_.init(participant_))
+            {
+                return false;
+            }
+
+            // The echo writer exists before the reader can deliver anything
+            if (config_.echo && !init_echo())
+            {
+                return false;
+            }
+
             // Create the DataReader
-            #if SHM_TRANSPORT
             DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
             subscriber_->get_default_datareader_qos(reader_qos);
-            reader_qos.reliability().kind = ReliabilityQosPolicyKind::RELIABLE_RELIABILITY_QOS;
-            reader_qos.durability().kind = DurabilityQosPolicyKind::TRANSIENT_LOCAL_DURABILITY_QOS;
-            reader_qos.data_sharing().automatic();
-            #endif
-            reader_ = subscriber_->create_datareader(topic_, reader_qos, &listener_);
+            apply_reader_qos(config_, reader_qos);
+            // With a receive thread the listener only reports matching, the thread takes the data
+            reader_ = subscriber_->create_datareader(topic_, reader_qos, &listener_,
+                            config_.receive == ReceiveEngine::LISTENER ?
+                            StatusMask::all() : StatusMask::subscription_matched());
 
             if (reader_ == nullptr)
             {
                 return false;
             }
 
+            if (listener_.mode_ == ReceiveMode::LOAN && reader_qos.data_sharing().kind() == DataSharingKind::OFF)
+            {
+                std::cout << "Data sharing is disabled: loaned frames are deserialized copies, "
+                          << "not views of the writer memory." << std::endl;
+            }
+
             return true;
         }
 
         //!Run the Subscriber
-        void run(
-                uint32_t samples)
+        void run()
         {
-            while (listener_.samples_ < samples)
+            const uint32_t samples = config_.samples;
+            // Live stats replace the interval and sequence lines with one line per period
+            const uint32_t report_interval_ms = config_.live_stats_ms > 0 ? config_.live_stats_ms :
+                    config_.report_interval_ms;
+            auto next_report = std::chrono::steady_clock::now() + std::chrono::milliseconds(report_interval_ms);
+            auto timeout = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<double>(config_.timeout_s));
+            auto last_progress = std::chrono::steady_clock::now();
+            uint32_t last_count = 0;
+            bool timed_out = false;
+            std::thread receiver;
+            if (config_.receive != ReceiveEngine::LISTENER)
+            {
+                receiver = std::thread([this]()
+                                {
+                                    receive_loop();
+                                });
+            }
+            while (static_cast<uint32_t>(listener_.samples_) < samples)
             {
                 std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                auto now = std::chrono::steady_clock::now();
+                if (report_interval_ms > 0 && now >= next_report)
+                {
+                    next_report += std::chrono::milliseconds(report_interval_ms);
+                    ReceiveReport interval = listener_.stats_.interval_report(now_ns(listener_.clock_));
+                    if (config_.live_stats_ms > 0)
+                    {
+                        live_.publish(interval, matched_writers());
+                    }
+                    else
+                    {
+                        std::cout << "[interval] " << interval.to_string() << std::endl;
+                        std::cout << "[sequence] " << listener_.stats_.sequence().to_string() << ", reader lost "
+                                  << reader_lost() << std::endl;
+                    }
+                }
+
+                // Lost samples never arrive: give up once nothing was received for timeout_s
+                uint32_t count = static_cast<uint32_t>(listener_.samples_);
+                if (count != last_count)
+                {
+                    last_count = count;
+                    last_progress = now;
+                }
+                else if (config_.timeout_s > 0 && now - last_progress >= timeout)
+                {
+                    std::cout << "No sample received for " << config_.timeout_s << " s, giving up with "
+                              << count << "/" << samples << " samples" << std::endl;
+                    timed_out = true;
+                    break;
+                }
+            }
+            if (receiver.joinable())
+            {
+                stop_ = true;
+                receiver.join();
+                std::cout << "[receive] " << waits_ << " waits, " << empty_polls_ << " empty polls" << std::endl;
+            }
+            if (config_.live_stats_ms > 0)
+            {
+                // The last, shorter period, so that the totals of the topic match the run
+                live_.publish(listener_.stats_.interval_report(now_ns(listener_.clock_)), matched_writers());
+            }
+
+            ReceiveReport total = listener_.stats_.total_report();
+            std::cout << "[total] " << total.to_string() << std::endl;
+            // Indexes still missing now are lost for good
+            SequenceStats sequence = listener_.stats_.sequence(true);
+            const int32_t lost_by_reader = reader_lost();
+            std::cout << "[sequence] " << sequence.to_string() << ", reader lost " << lost_by_reader << std::endl;
+            // The listener may still take: every take path counter is copied at once
+            const SubListener::Counters counters = listener_.counters();
+            const CodecStats& codec = counters.codec;
+            if (codec.coded > 0)
+            {
+                std::cout << "[compression] " << codec.to_string("decode") << std::endl;
+            }
+            if (listener_.reassembler_)
+            {
+                std::cout << "[chunks] " << counters.reassembly.to_string() << std::endl;
+            }
+            const BatchStats& batches = counters.batches;
+            if (batches.takes > 0)
+            {
+                std::cout << "[batches] " << batches.to_string() << std::endl;
+            }
+            if (!config_.report.empty())
+            {
+                std::ofstream report(config_.report);
+                report << "{\"expected\": " << samples << ", \"timed_out\": " << (timed_out ? "true" : "false")
+                       << ", \"total\": " << total.to_json() << ", \"sequence\": " << sequence.to_json()
+                       << ", \"reader_lost\": " << lost_by_reader << ", \"compression\": " << codec.to_json("decode");
+                if (listener_.reassembler_)
+                {
+                    report << ", \"reassembly\": " << counters.reassembly.to_json();
+                }
+                if (batches.takes > 0)
+                {
+                    report << ", \"batches\": " << batches.to_json();
+                }
+                report << "}" << std::endl;
+                if (!report)
+                {
+                    std::cout << "Error writing " << config_.report << std::endl;
+                }
+            }
+
+            if (listener_.echo_writer_ != nullptr)
+            {
+                // The last echoes are still in flight when the last frame is counted
+                if (config_.reliable && listener_.echo_writer_->wait_for_acknowledgments(Duration_t(1, 0)) !=
+                        RETCODE_OK)
+                {
+                    std::cout << "Not every echo was acknowledged" << std::endl;
+                }
+                std::cout << "[echo] " << counters.echoed << " replies sent, " << counters.echo_failures
+                          << " failed" << std::endl;
+            }
+
+            listener_.recorder_.stop();
+            std::cout << listener_.recorder_.recorded() << " latency records written to latency.bin";
+            if (listener_.recorder_.dropped() > 0)
+            {
+                std::cout << ", " << listener_.recorder_.dropped() << " dropped";
+            }
+            std::cout << std::endl;
+            if (listener_.mode_ == ReceiveMode::COPY)
+            {
+                FramePoolStats pool_stats = pool().stats();
+                std::cout << "Frame pool: " << pool_stats.allocated << " samples allocated, "
+                          << pool_stats.reused << " reused, " << pool_stats.grown << " buffer reallocations"
+                          << std::endl;
+            }
+            if (config_.export_csv && !listener_.recorder_.export_csv("latency.csv"))
+            {
+                std::cout << "Error exporting latency.csv" << std::endl;
             }
         }
 
+    private:
+
+        //!Samples the reader knows it lost (SampleLostStatus), e.g. best-effort gaps
+        int32_t reader_lost()
+        {
+            SampleLostStatus status;
+            return reader_->get_sample_lost_status(status) == RETCODE_OK ? status.total_count : 0;
+        }
+
+        //!Writers matched with the reader now
+        uint32_t matched_writers()
+        {
+            SubscriptionMatchedStatus status;
+            return reader_->get_subscription_matched_status(status) == RETCODE_OK ?
+                   static_cast<uint32_t>(status.current_count) : 0;
+        }
+
+        //!Create the writer that republishes the received frames on the reply topic, as Minimal samples
+        bool init_echo()
+        {
+            // The frame type is Minimal already unless frames arrive loaned or in chunks
+            TypeSupport reply_type = config_.loan || config_.chunked() ?
+                    TypeSupport(new MinimalFastPubSubType()) : type_;
+            reply_type.register_type(participant_);
+            reply_topic_ = participant_->create_topic(config_.reply_topic_name(config_.stream),
+                            reply_type.get_type_name(), TOPIC_QOS_DEFAULT);
+            if (reply_topic_ == nullptr)
+            {
+                return false;
+            }
+            publisher_ = participant_->create_publisher(PUBLISHER_QOS_DEFAULT, nullptr);
+            if (publisher_ == nullptr)
+            {
+                return false;
+            }
+
+            DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+            publisher_->get_default_datawriter_qos(writer_qos);
+            apply_writer_qos(config_, writer_qos, config_.stream);
+            listener_.echo_writer_ = publisher_->create_datawriter(reply_topic_, writer_qos, nullptr);
+            if (listener_.echo_writer_ == nullptr)
+            {
+                return false;
+            }
+            if (!config_.echo_header_only && (config_.loan || config_.chunked()))
+            {
+                listener_.reply_.img_data().reserve(config_.data_size);
+            }
+            std::cout << "Echoing " << (config_.echo_header_only ? "frame headers" : "frames") << " on "
+                      << config_.reply_topic_name(config_.stream) << std::endl;
+            return true;
+        }
+
+        //!Take samples on this thread until stop_, waiting on a read condition and/or spinning per config.receive
+        void receive_loop()
+        {
+            if (config_.receive_cpu >= 0 && !pin_current_thread(config_.receive_cpu))
+            {
+                std::cout << "Cannot pin the receive thread to CPU " << config_.receive_cpu << std::endl;
+            }
+
+            ReadCondition* condition = reader_->create_readcondition(NOT_READ_SAMPLE_STATE, ANY_VIEW_STATE,
+                            ANY_INSTANCE_STATE);
+            if (condition == nullptr)
+            {
+                std::cout << "Error creating the read condition" << std::endl;
+                return;
+            }
+            WaitSet waitset;
+            waitset.attach_condition(*condition);
+            ConditionSeq active;
+            // Bounded so that stop_ is seen even when the publisher is gone
+            const Duration_t max_wait(0, 100000000);
+            const auto spin = std::chrono::microseconds(config_.spin_us);
+            auto last_sample = std::chrono::steady_clock::now();
+
+            while (!stop_)
+            {
+                if (listener_.take_available(reader_) > 0)
+                {
+                    if (config_.receive == ReceiveEngine::HYBRID)
+                    {
+                        last_sample = std::chrono::steady_clock::now();
+                    }
+                    continue;
+                }
+                ++empty_polls_;
+                if (config_.receive == ReceiveEngine::POLL ||
+                        (config_.receive == ReceiveEngine::HYBRID &&
+                        std::chrono::steady_clock::now() - last_sample < spin))
+                {
+                    continue;
+                }
+                ++waits_;
+                waitset.wait(active, max_wait);
+            }
+
+            waitset.detach_condition(*condition);
+            reader_->delete_readcondition(condition);
+        }
+
+        //!Samples of create_data and buffer growth counters (ReceiveMode::COPY only)
+        FramePool& pool()
+        {
+            return static_cast<MinimalFastPubSubType*>(type_.get())->pool();
+        }
 };
 
 int main(int argc, char** argv)
 {
-    std::cout << "Starting subscriber." << std::endl;
-    MinimalSubscriber subscriber;
-    int samples = 10;
+    MinimalConfig config;
+    if (!parse_options(argc, argv, config))
+    {
+        return 1;
+    }
+
+    std::cout << "Starting subscriber (" << config.qos_summary() << ")." << std::endl;
+    MinimalSubscriber subscriber(config);
 
     if (subscriber.init())
     {
-        subscriber.run(samples);
+        subscriber.run();
     }
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,319 @@
+// Fan-out benchmark: K DataReaders on the Minimal topic in one process
+// Each reader keeps its own statistics, the aggregate shows what one-to-many
+// delivery costs as the reader count grows.
+
+#include "MinimalPubSubTypes.hpp"
+#include "minimal_fast_types.hpp"
+#include "minimal_clock.hpp"
+#include "minimal_config.hpp"
+#include "receive_stats.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <fastdds/dds/core/LoanableSequence.hpp>
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/DataReaderListener.hpp>
+#include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
+#include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+
+using namespace eprosima::fastdds::dds;
+
+FASTDDS_SEQUENCE(MinimalFrameSeq, MinimalFrame);
+
+class MultipleSubscribers
+{
+    private:
+
+    class ReaderListener : public DataReaderListener
+    {
+        public:
+            ReaderListener(
+                    bool loan,
+                    ClockDomain clock,
+                    const CompressionConfig& compression,
+                    uint32_t max_frame_size)
+                : loan_(loan)
+                , clock_(clock)
+                , decoder_(compression, max_frame_size)
+                , samples_(0)
+            {
+            }
+
+            void on_data_available(
+                    DataReader* reader) override
+            {
+                if (loan_)
+                {
+                    MinimalFrameSeq frames;
+                    SampleInfoSeq infos;
+                    if (reader->take(frames, infos) != RETCODE_OK)
+                    {
+                        return;
+                    }
+                    for (LoanableCollection::size_type i = 0; i < frames.length(); ++i)
+                    {
+                        if (infos[i].valid_data)
+                        {
+                            on_sample(infos[i].publication_handle, frames[i].index(), frames[i].time_stamp(),
+                                    frames[i].img_size());
+                        }
+                    }
+                    reader->return_loan(frames, infos);
+                    return;
+                }
+
+                SampleInfo info;
+                while (reader->take_next_sample(&minimal_, &info) == RETCODE_OK)
+                {
+                    if (info.valid_data && decoder_.decode(minimal_.codec(), minimal_.img_data().data(),
+                            minimal_.img_data().size(), minimal_.raw_size()) != nullptr)
+                    {
+                        on_sample(info.publication_handle, minimal_.index(), minimal_.time_stamp(),
+                                minimal_.codec() != 0 ? minimal_.raw_size() :
+                                static_cast<uint32_t>(minimal_.img_data().size()));
+                    }
+                }
+            }
+
+            void on_sample(
+                    const InstanceHandle_t& writer,
+                    uint32_t index,
+                    uint64_t time_stamp,
+                    uint32_t size)
+            {
+                uint64_t now = now_ns(clock_);
+                stats_.on_sample(writer, index, static_cast<int64_t>(now - time_stamp), size, now);
+                samples_.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            bool loan_;
+            ClockDomain clock_;
+            Minimal minimal_;
+            FrameDecoder decoder_;
+            ReceiveStats stats_;
+            std::atomic<uint32_t> samples_;
+    };
+
+    struct Reader
+    {
+        DomainParticipant* participant = nullptr;
+        bool owns_participant = false;
+        Subscriber* subscriber = nullptr;
+        Topic* topic = nullptr;
+        DataReader* reader = nullptr;
+        std::unique_ptr<ReaderListener> listener;
+    };
+
+        MinimalConfig config_;
+        TypeSupport type_;
+        std::vector<Reader> readers_;
+
+    public:
+        MultipleSubscribers(
+                const MinimalConfig& config)
+            : config_(config)
+            , type_(config.loan ?
+                    static_cast<TopicDataType*>(new MinimalFrameFastPubSubType()) :
+                    static_cast<TopicDataType*>(new MinimalFastPubSubType()))
+        {
+        }
+
+        virtual ~MultipleSubscribers()
+        {
+            // Participants (and their topic) go after every reader they contain
+            for (Reader& r : readers_)
+            {
+                if (r.reader != nullptr)
+                {
+                    r.subscriber->delete_datareader(r.reader);
+                }
+                if (r.subscriber != nullptr)
+                {
+                    r.participant->delete_subscriber(r.subscriber);
+                }
+            }
+            for (Reader& r : readers_)
+            {
+                if (r.owns_participant)
+                {
+                    if (r.topic != nullptr)
+                    {
+                        r.participant->delete_topic(r.topic);
+                    }
+                    DomainParticipantFactory::get_instance()->delete_participant(r.participant);
+                }
+            }
+        }
+
+        //!Create config.readers readers, each in its own participant unless shared_participant is set
+        bool init()
+        {
+            if (config_.chunked())
+            {
+                std::cout << "MultipleSubs does not reassemble chunks, use Subscriber with --chunk-size" << std::endl;
+                return false;
+            }
+            if (config_.echo)
+            {
+                std::cout << "MultipleSubs does not echo frames, use Subscriber with --echo" << std::endl;
+                return false;
+            }
+            if (config_.live_stats_ms > 0)
+            {
+                std::cout << "MultipleSubs does not publish live stats, use Subscriber with --live-stats" << std::endl;
+                return false;
+            }
+            if (config_.receive != ReceiveEngine::LISTENER)
+            {
+                std::cout << "MultipleSubs only takes samples in listeners, use Subscriber with --receive" << std::endl;
+                return false;
+            }
+
+            readers_.resize(config_.readers);
+            for (uint32_t i = 0; i < config_.readers; ++i)
+            {
+                Reader& r = readers_[i];
+                if (i == 0 || !config_.shared_participant)
+                {
+                    DomainParticipantQos pqos = make_participant_qos(config_,
+                                    "Participant_subscriber_" + std::to_string(i));
+                    r.participant = DomainParticipantFactory::get_instance()->create_participant(config_.domain, pqos);
+                    if (r.participant == nullptr)
+                    {
+                        return false;
+                    }
+                    r.owns_participant = true;
+                    type_.register_type(r.participant);
+                    r.topic = r.participant->create_topic(config_.topic_name(config_.stream),
+                                    type_.get_type_name(), TOPIC_QOS_DEFAULT);
+                    if (r.topic == nullptr)
+                    {
+                        return false;
+                    }
+                }
+                else
+                {
+                    r.participant = readers_[0].participant;
+                    r.topic = readers_[0].topic;
+                }
+
+                r.subscriber = r.participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT, nullptr);
+                if (r.subscriber == nullptr)
+                {
+                    return false;
+                }
+
+                DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+                r.subscriber->get_default_datareader_qos(reader_qos);
+                apply_reader_qos(config_, reader_qos);
+                r.listener.reset(new ReaderListener(config_.loan, config_.clock, config_.compression,
+                        config_.frame_limit()));
+                FramePool::reserve(r.listener->minimal_, config_.loan ? 0 : config_.data_size);
+                r.reader = r.subscriber->create_datareader(r.topic, reader_qos, r.listener.get());
+                if (r.reader == nullptr)
+                {
+                    return false;
+                }
+            }
+            std::cout << config_.readers << " readers on " << config_.topic_name(config_.stream)
+                      << (config_.shared_participant ? " in one participant" : ", one participant each")
+                      << std::endl;
+            return true;
+        }
+
+        //!Wait until every reader got config.samples samples (or the idle timeout), then report
+        void run()
+        {
+            const uint64_t expected = static_cast<uint64_t>(config_.samples) * readers_.size();
+            auto timeout = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<double>(config_.timeout_s));
+            auto last_progress = std::chrono::steady_clock::now();
+            uint64_t last_count = 0;
+            bool timed_out = false;
+            while (received() < expected)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                auto now = std::chrono::steady_clock::now();
+                uint64_t count = received();
+                if (count != last_count)
+                {
+                    last_count = count;
+                    last_progress = now;
+                }
+                else if (config_.timeout_s > 0 && now - last_progress >= timeout)
+                {
+                    std::cout << "No sample received for " << config_.timeout_s << " s, giving up with "
+                              << count << "/" << expected << " deliveries" << std::endl;
+                    timed_out = true;
+                    break;
+                }
+            }
+
+            ReceiveStats aggregate;
+            std::vector<ReceiveReport> reports;
+            for (size_t i = 0; i < readers_.size(); ++i)
+            {
+                ReceiveStats& stats = readers_[i].listener->stats_;
+                reports.push_back(stats.total_report());
+                stats.merge_total_into(aggregate);
+                std::cout << "[reader " << i << "] " << reports.back().to_string() << std::endl;
+            }
+            ReceiveReport total = aggregate.total_report();
+            std::cout << "[aggregate] " << total.to_string() << std::endl;
+
+            if (!config_.report.empty())
+            {
+                std::ofstream report(config_.report);
+                report << "{\"expected\": " << expected << ", \"timed_out\": " << (timed_out ? "true" : "false")
+                       << ", \"total\": " << total.to_json() << ", \"readers\": [";
+                for (size_t i = 0; i < reports.size(); ++i)
+                {
+                    report << (i > 0 ? ", " : "") << reports[i].to_json();
+                }
+                report << "]}" << std::endl;
+                if (!report)
+                {
+                    std::cout << "Error writing " << config_.report << std::endl;
+                }
+            }
+        }
+
+    private:
+
+        uint64_t received() const
+        {
+            uint64_t count = 0;
+            for (const Reader& r : readers_)
+            {
+                count += r.listener ? r.listener->samples_.load(std::memory_order_relaxed) : 0;
+            }
+            return count;
+        }
+};
+
+int main(int argc, char** argv)
+{
+    MinimalConfig config;
+    if (!parse_options(argc, argv, config))
+    {
+        return 1;
+    }
+
+    std::cout << "Starting MultipleSubs (" << config.qos_summary() << ")." << std::endl;
+    MultipleSubscribers subscribers(config);
+
+    if (subscribers.init())
+    {
+        subscribers.run();
+    }
+    return 0;
+}
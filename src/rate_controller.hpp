@@ -0,0 +1,239 @@
+// Publication pacing for the Minimal publisher
+
+#ifndef RATE_CONTROLLER_HPP
+#define RATE_CONTROLLER_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+#include "latency_histogram.hpp"
+
+enum class PacingMode
+{
+    RATE,       // rate_hz samples per second on absolute deadlines
+    BURST,      // burst_size samples back to back, rate_hz bursts per second
+    SATURATE,   // as fast as the writer accepts
+    RAMP        // rate stepped up until a loss or write latency target is violated
+};
+
+struct PacingConfig
+{
+    PacingMode mode = PacingMode::RATE;
+    double rate_hz = 1.0;
+    uint32_t burst_size = 10;
+    // RAMP: start at rate_hz, add ramp_step_hz every ramp_step_s seconds up to ramp_max_hz
+    double ramp_step_hz = 10.0;
+    double ramp_max_hz = 10000.0;
+    double ramp_step_s = 2.0;
+    // RAMP: a step fails when more than max_loss of its writes fail, when the achieved rate
+    // is below min_achieved of the target, or when the p99 write() time exceeds max_write_p99_us
+    double max_loss = 0.0;
+    double min_achieved = 0.95;
+    double max_write_p99_us = 10000.0;
+};
+
+//!Parse "rate", "burst", "saturate" or "ramp"
+inline bool parse_pacing_mode(
+        const char* name,
+        PacingMode& mode)
+{
+    if (std::strcmp(name, "rate") == 0)
+    {
+        mode = PacingMode::RATE;
+    }
+    else if (std::strcmp(name, "burst") == 0)
+    {
+        mode = PacingMode::BURST;
+    }
+    else if (std::strcmp(name, "saturate") == 0)
+    {
+        mode = PacingMode::SATURATE;
+    }
+    else if (std::strcmp(name, "ramp") == 0)
+    {
+        mode = PacingMode::RAMP;
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+//!Parse a number greater than 0, false for anything else (atof would read garbage as 0)
+inline bool parse_positive_double(
+        const char* value,
+        double& out)
+{
+    char* end = nullptr;
+    double parsed = std::strtod(value, &end);
+    if (end == value || *end != '\0' || !(parsed > 0))
+    {
+        return false;
+    }
+    out = parsed;
+    return true;
+}
+
+// Decides when the next sample is sent. Deadlines are absolute (start + n * period)
+// and waited with sleep_until, so the time spent publishing does not add drift.
+// When the publisher falls more than one period behind, the schedule is rebased
+// instead of sending a catch-up burst.
+class RateController
+{
+    public:
+        typedef std::chrono::steady_clock clock;
+
+        explicit RateController(
+                const PacingConfig& config)
+            : config_(config)
+            , rate_hz_(config.rate_hz)
+            , sent_in_burst_(0)
+            , finished_(false)
+            , last_good_hz_(0.0)
+        {
+            restart();
+        }
+
+        //!Start a fresh schedule from now (e.g. once a subscriber matched)
+        void restart()
+        {
+            deadline_ = clock::now();
+            step_start_ = deadline_;
+            sent_in_burst_ = 0;
+            reset_step();
+        }
+
+        //!Block until the next sample is due
+        void wait()
+        {
+            switch (config_.mode)
+            {
+                case PacingMode::SATURATE:
+                    return;
+                case PacingMode::BURST:
+                    if (sent_in_burst_ < config_.burst_size)
+                    {
+                        ++sent_in_burst_;
+                        return;
+                    }
+                    sent_in_burst_ = 1;
+                    break;
+                default:
+                    break;
+            }
+
+            deadline_ += period();
+            clock::time_point now = clock::now();
+            if (deadline_ + period() < now)
+            {
+                deadline_ = now;
+            }
+            std::this_thread::sleep_until(deadline_);
+        }
+
+        //!Feed back the outcome of a publication attempt (only used by RAMP)
+        void on_result(
+                bool sent,
+                uint64_t write_ns)
+        {
+            if (config_.mode != PacingMode::RAMP)
+            {
+                return;
+            }
+
+            ++step_attempts_;
+            if (!sent)
+            {
+                ++step_failed_;
+            }
+            step_write_ns_.record(write_ns);
+
+            double elapsed = std::chrono::duration<double>(clock::now() - step_start_).count();
+            if (elapsed >= config_.ramp_step_s)
+            {
+                end_step(elapsed);
+            }
+        }
+
+        //!True when the RAMP found its limit (or reached ramp_max_hz)
+        bool finished() const
+        {
+            return finished_;
+        }
+
+        //!RAMP never stops on a sample count, only on its own targets
+        bool unbounded() const
+        {
+            return config_.mode == PacingMode::RAMP;
+        }
+
+        double last_good_hz() const
+        {
+            return last_good_hz_;
+        }
+
+    private:
+
+        clock::duration period() const
+        {
+            return std::chrono::duration_cast<clock::duration>(std::chrono::duration<double>(1.0 / rate_hz_));
+        }
+
+        void reset_step()
+        {
+            step_attempts_ = 0;
+            step_failed_ = 0;
+            step_write_ns_.reset();
+        }
+
+        void end_step(
+                double elapsed)
+        {
+            double achieved = step_attempts_ / elapsed;
+            double loss = step_attempts_ > 0 ? static_cast<double>(step_failed_) / step_attempts_ : 0.0;
+            double write_p99_us = step_write_ns_.value_at_percentile(99.0) / 1e3;
+            bool ok = loss <= config_.max_loss &&
+                    achieved >= config_.min_achieved * rate_hz_ &&
+                    write_p99_us <= config_.max_write_p99_us;
+
+            std::cout << "Ramp step: target " << rate_hz_ << " Hz, achieved " << achieved
+                      << " Hz, failed writes " << step_failed_ << "/" << step_attempts_
+                      << ", write p99 " << write_p99_us << " us" << (ok ? "" : " -> VIOLATED") << std::endl;
+
+            if (!ok)
+            {
+                finished_ = true;
+                std::cout << "Saturation point: " << last_good_hz_ << " Hz" << std::endl;
+                return;
+            }
+
+            last_good_hz_ = rate_hz_;
+            if (rate_hz_ + config_.ramp_step_hz > config_.ramp_max_hz)
+            {
+                finished_ = true;
+                std::cout << "Ramp reached " << rate_hz_ << " Hz without violating its targets" << std::endl;
+                return;
+            }
+            rate_hz_ += config_.ramp_step_hz;
+            step_start_ = clock::now();
+            reset_step();
+        }
+
+        PacingConfig config_;
+        double rate_hz_;
+        clock::time_point deadline_;
+        clock::time_point step_start_;
+        uint32_t sent_in_burst_;
+        bool finished_;
+        double last_good_hz_;
+        uint64_t step_attempts_;
+        uint64_t step_failed_;
+        LatencyHistogram step_write_ns_;
+};
+
+#endif // RATE_CONTROLLER_HPP
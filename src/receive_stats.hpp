@@ -0,0 +1,295 @@
+// Online latency/throughput/loss statistics for the Minimal subscriber
+
+#ifndef RECEIVE_STATS_HPP
+#define RECEIVE_STATS_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+
+#include <fastdds/rtps/common/InstanceHandle.hpp>
+
+#include "latency_histogram.hpp"
+#include "sequence_tracker.hpp"
+
+// Summary of a window of received samples
+struct ReceiveReport
+{
+    uint64_t samples;
+    uint64_t lost;
+    uint64_t bytes;
+    double seconds;
+    uint64_t min_ns;
+    uint64_t p50_ns;
+    uint64_t p90_ns;
+    uint64_t p99_ns;
+    uint64_t p999_ns;
+    uint64_t max_ns;
+
+    double samples_per_second() const
+    {
+        return seconds > 0 ? samples / seconds : 0.0;
+    }
+
+    double mbytes_per_second() const
+    {
+        return seconds > 0 ? bytes / seconds / 1e6 : 0.0;
+    }
+
+    //!One line summary, latencies in microseconds
+    std::string to_string() const
+    {
+        char line[512];
+        std::snprintf(line, sizeof(line),
+                "samples: %llu (%.1f samples/s, %.2f MB/s) lost: %llu "
+                "latency us min/p50/p90/p99/p99.9/max: %.1f/%.1f/%.1f/%.1f/%.1f/%.1f",
+                static_cast<unsigned long long>(samples), samples_per_second(), mbytes_per_second(),
+                static_cast<unsigned long long>(lost),
+                min_ns / 1e3, p50_ns / 1e3, p90_ns / 1e3, p99_ns / 1e3, p999_ns / 1e3, max_ns / 1e3);
+        return line;
+    }
+
+    //!Flat JSON object with the same fields, latencies in nanoseconds
+    std::string to_json() const
+    {
+        char json[512];
+        std::snprintf(json, sizeof(json),
+                "{\"samples\": %llu, \"lost\": %llu, \"bytes\": %llu, \"seconds\": %.6f, "
+                "\"samples_per_second\": %.3f, \"mbytes_per_second\": %.3f, "
+                "\"min_ns\": %llu, \"p50_ns\": %llu, \"p90_ns\": %llu, \"p99_ns\": %llu, "
+                "\"p999_ns\": %llu, \"max_ns\": %llu}",
+                static_cast<unsigned long long>(samples), static_cast<unsigned long long>(lost),
+                static_cast<unsigned long long>(bytes), seconds, samples_per_second(), mbytes_per_second(),
+                static_cast<unsigned long long>(min_ns), static_cast<unsigned long long>(p50_ns),
+                static_cast<unsigned long long>(p90_ns), static_cast<unsigned long long>(p99_ns),
+                static_cast<unsigned long long>(p999_ns), static_cast<unsigned long long>(max_ns));
+        return json;
+    }
+};
+
+// Samples returned per take() call, in power of two buckets (1, 2-3, 4-7, ...).
+// Updated by the thread that takes the samples only.
+struct BatchStats
+{
+    static const int BUCKETS = 16;      // The last one holds 32768 and more
+
+    uint64_t takes = 0;
+    uint64_t samples = 0;
+    uint32_t max = 0;
+    uint64_t buckets[BUCKETS] = {};
+
+    void on_take(
+            uint32_t count)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+        ++takes;
+        samples += count;
+        max = count > max ? count : max;
+        int bucket = 0;
+        while (count > 1 && bucket < BUCKETS - 1)
+        {
+            count >>= 1;
+            ++bucket;
+        }
+        ++buckets[bucket];
+    }
+
+    double mean() const
+    {
+        return takes > 0 ? static_cast<double>(samples) / takes : 0.0;
+    }
+
+    //!One line summary, with the non-empty buckets as "first-last:takes"
+    std::string to_string() const
+    {
+        char line[128];
+        std::snprintf(line, sizeof(line), "%llu takes, %.2f samples per take (max %u), sizes:",
+                static_cast<unsigned long long>(takes), mean(), max);
+        std::string text = line;
+        for (int i = 0; i < BUCKETS; ++i)
+        {
+            if (buckets[i] > 0)
+            {
+                unsigned first = 1u << i;
+                if (i == 0 || i == BUCKETS - 1)
+                {
+                    std::snprintf(line, sizeof(line), " %u%s:%llu", first, i == 0 ? "" : "+",
+                            static_cast<unsigned long long>(buckets[i]));
+                }
+                else
+                {
+                    std::snprintf(line, sizeof(line), " %u-%u:%llu", first, 2 * first - 1,
+                            static_cast<unsigned long long>(buckets[i]));
+                }
+                text += line;
+            }
+        }
+        return text;
+    }
+
+    std::string to_json() const
+    {
+        char json[128];
+        std::snprintf(json, sizeof(json), "{\"takes\": %llu, \"samples_taken\": %llu, \"mean_batch\": %.3f, "
+                "\"max_batch\": %u, \"buckets\": [",
+                static_cast<unsigned long long>(takes), static_cast<unsigned long long>(samples), mean(), max);
+        std::string text = json;
+        for (int i = 0; i < BUCKETS; ++i)
+        {
+            text += (i > 0 ? ", " : "") + std::to_string(buckets[i]);
+        }
+        return text + "]}";
+    }
+};
+
+// Keeps one histogram for the current reporting interval and one for the whole
+// run. Losses are those of the SequenceTracker, so the reports and the sequence
+// counters agree: a reordered sample takes back the loss its gap counted. on_sample()
+// is called from the receive path and report() from the reporting thread; the lock
+// is uncontended except for the instant a report is taken.
+class ReceiveStats
+{
+    public:
+        ReceiveStats()
+        {
+            interval_.reset(0);
+            total_.reset(0);
+        }
+
+        void on_sample(
+                const eprosima::fastdds::rtps::InstanceHandle_t& writer,
+                uint32_t index,
+                int64_t latency_ns,
+                uint64_t bytes,
+                uint64_t now_ns)
+        {
+            const int64_t lost = sequence_.on_sample(writer, index);
+            std::lock_guard<std::mutex> guard(mutex_);
+            // Negative latencies (non comparable clocks) are clamped to 0
+            uint64_t latency = latency_ns > 0 ? static_cast<uint64_t>(latency_ns) : 0;
+            interval_.add(latency, bytes, lost, now_ns);
+            total_.add(latency, bytes, lost, now_ns);
+        }
+
+        //!Report of the samples received since the previous interval report, and start a new interval
+        ReceiveReport interval_report(
+                uint64_t now_ns)
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            ReceiveReport report = interval_.report(now_ns);
+            interval_.reset(now_ns);
+            return report;
+        }
+
+        //!Report of the whole run, from the first to the last received sample
+        ReceiveReport total_report()
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            return total_.report(total_.last_ns);
+        }
+
+        //!Sequence counters of the writers, see SequenceTracker::stats()
+        SequenceStats sequence(
+                bool settle = false)
+        {
+            return sequence_.stats(settle);
+        }
+
+        //!Add the whole run of this instance to aggregate, used to combine several readers
+        void merge_total_into(
+                ReceiveStats& aggregate)
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            std::lock_guard<std::mutex> aggregate_guard(aggregate.mutex_);
+            aggregate.total_.merge(total_);
+        }
+
+    private:
+
+        struct Window
+        {
+            LatencyHistogram histogram;
+            uint64_t samples;
+            int64_t lost;                   // Negative when a window only fills gaps of earlier ones
+            uint64_t bytes;
+            uint64_t start_ns;
+            uint64_t last_ns;
+
+            void reset(
+                    uint64_t now_ns)
+            {
+                histogram.reset();
+                samples = 0;
+                lost = 0;
+                bytes = 0;
+                start_ns = now_ns;
+                last_ns = now_ns;
+            }
+
+            void add(
+                    uint64_t latency_ns,
+                    uint64_t sample_bytes,
+                    int64_t sample_lost,
+                    uint64_t now_ns)
+            {
+                if (samples == 0 && start_ns == 0)
+                {
+                    start_ns = now_ns;
+                }
+                histogram.record(latency_ns);
+                ++samples;
+                lost += sample_lost;
+                bytes += sample_bytes;
+                last_ns = now_ns;
+            }
+
+            void merge(
+                    const Window& other)
+            {
+                if (other.samples == 0)
+                {
+                    return;
+                }
+                if (samples == 0 || other.start_ns < start_ns)
+                {
+                    start_ns = other.start_ns;
+                }
+                if (other.last_ns > last_ns)
+                {
+                    last_ns = other.last_ns;
+                }
+                histogram.merge(other.histogram);
+                samples += other.samples;
+                lost += other.lost;
+                bytes += other.bytes;
+            }
+
+            ReceiveReport report(
+                    uint64_t end_ns) const
+            {
+                ReceiveReport report;
+                report.samples = samples;
+                report.lost = lost > 0 ? static_cast<uint64_t>(lost) : 0;
+                report.bytes = bytes;
+                report.seconds = end_ns > start_ns ? (end_ns - start_ns) / 1e9 : 0.0;
+                report.min_ns = histogram.min();
+                report.p50_ns = histogram.value_at_percentile(50.0);
+                report.p90_ns = histogram.value_at_percentile(90.0);
+                report.p99_ns = histogram.value_at_percentile(99.0);
+                report.p999_ns = histogram.value_at_percentile(99.9);
+                report.max_ns = histogram.max();
+                return report;
+            }
+        };
+
+        std::mutex mutex_;
+        Window interval_;
+        Window total_;
+        SequenceTracker sequence_;
+};
+
+#endif // RECEIVE_STATS_HPP
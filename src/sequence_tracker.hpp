@@ -0,0 +1,260 @@
+// Per-writer sequence tracking of the Minimal subscriber: loss, loss bursts, reordering and duplicates
+
+#ifndef SEQUENCE_TRACKER_HPP
+#define SEQUENCE_TRACKER_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <fastdds/rtps/common/InstanceHandle.hpp>
+
+// Sequence counters of one writer, or summed over several
+struct SequenceStats
+{
+    static const int BUCKETS = 16;      // Burst lengths 1, 2-3, 4-7, ..., the last one 32768 and more
+
+    uint64_t writers = 0;
+    uint64_t received = 0;              // Distinct indexes received
+    uint64_t lost = 0;                  // Indexes skipped and not received later (so far: still missing)
+    uint64_t reordered = 0;             // Received after a higher index, in time to fill their gap
+    uint64_t late = 0;                  // Received too long after a higher index, already counted lost
+    uint64_t duplicates = 0;
+    uint64_t bursts = 0;                // Runs of consecutive lost indexes, once they are settled
+    uint32_t max_burst = 0;
+    uint64_t burst_buckets[BUCKETS] = {};
+
+    double loss_rate() const
+    {
+        return received + lost > 0 ? static_cast<double>(lost) / (received + lost) : 0.0;
+    }
+
+    void add_burst(
+            uint32_t length)
+    {
+        ++bursts;
+        max_burst = length > max_burst ? length : max_burst;
+        int bucket = 0;
+        while (length > 1 && bucket < BUCKETS - 1)
+        {
+            length >>= 1;
+            ++bucket;
+        }
+        ++burst_buckets[bucket];
+    }
+
+    void merge(
+            const SequenceStats& other)
+    {
+        writers += other.writers;
+        received += other.received;
+        lost += other.lost;
+        reordered += other.reordered;
+        late += other.late;
+        duplicates += other.duplicates;
+        bursts += other.bursts;
+        max_burst = other.max_burst > max_burst ? other.max_burst : max_burst;
+        for (int i = 0; i < BUCKETS; ++i)
+        {
+            burst_buckets[i] += other.burst_buckets[i];
+        }
+    }
+
+    std::string to_string() const
+    {
+        char line[256];
+        std::snprintf(line, sizeof(line),
+                "%llu writer(s), received %llu, lost %llu (%.3f%%) in %llu bursts (max %u), "
+                "reordered %llu, late %llu, duplicates %llu",
+                static_cast<unsigned long long>(writers), static_cast<unsigned long long>(received),
+                static_cast<unsigned long long>(lost), 100.0 * loss_rate(), static_cast<unsigned long long>(bursts),
+                max_burst, static_cast<unsigned long long>(reordered), static_cast<unsigned long long>(late),
+                static_cast<unsigned long long>(duplicates));
+        return line;
+    }
+
+    std::string to_json() const
+    {
+        char json[320];
+        std::snprintf(json, sizeof(json),
+                "{\"writers\": %llu, \"received\": %llu, \"lost\": %llu, \"loss_rate\": %.6f, "
+                "\"bursts\": %llu, \"max_burst\": %u, \"reordered\": %llu, \"late\": %llu, \"duplicates\": %llu, "
+                "\"burst_buckets\": [",
+                static_cast<unsigned long long>(writers), static_cast<unsigned long long>(received),
+                static_cast<unsigned long long>(lost), loss_rate(), static_cast<unsigned long long>(bursts),
+                max_burst, static_cast<unsigned long long>(reordered), static_cast<unsigned long long>(late),
+                static_cast<unsigned long long>(duplicates));
+        std::string text = json;
+        for (int i = 0; i < BUCKETS; ++i)
+        {
+            text += (i > 0 ? ", " : "") + std::to_string(burst_buckets[i]);
+        }
+        return text + "]}";
+    }
+};
+
+// Tracks the index sequence of each writer, told apart by the publication
+// handle of SampleInfo, so that a restarted publisher (a new writer) starts a
+// new sequence instead of looking like reordering. The last WINDOW indexes of
+// each writer are kept in a bitmap: a skipped index counts as missing until it
+// arrives (reordered) or leaves the window (lost, its burst is then settled).
+// on_sample() is called from the receive path and stats() from the reporting
+// thread, the lock is uncontended otherwise.
+class SequenceTracker
+{
+    public:
+        static const uint32_t WINDOW = 1024;
+
+        //!Change of the lost count due to this sample: the indexes it skips, or -1 when it fills a gap
+        int64_t on_sample(
+                const eprosima::fastdds::rtps::InstanceHandle_t& writer,
+                uint32_t index)
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            if (last_ == nullptr || !(last_writer_ == writer))
+            {
+                last_writer_ = writer;
+                last_ = &writers_[writer];
+            }
+            const uint64_t lost = last_->stats.lost;
+            last_->on_index(index);
+            return static_cast<int64_t>(last_->stats.lost - lost);
+        }
+
+        //!Counters summed over the writers. With settle, the indexes still missing are final: call it once
+        //!the run is over
+        SequenceStats stats(
+                bool settle = false)
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            SequenceStats total;
+            for (auto& writer : writers_)
+            {
+                if (settle)
+                {
+                    writer.second.settle();
+                }
+                total.merge(writer.second.stats);
+            }
+            return total;
+        }
+
+    private:
+
+        struct WriterSequence
+        {
+            SequenceStats stats;
+            std::vector<uint8_t> seen = std::vector<uint8_t>(WINDOW, 0);    // Indexed by index % WINDOW
+            bool started = false;
+            uint32_t first = 0;
+            uint32_t highest = 0;
+            uint32_t run = 0;               // Lost indexes in a row, not settled yet
+
+            void on_index(
+                    uint32_t index)
+            {
+                if (!started)
+                {
+                    started = true;
+                    stats.writers = 1;
+                    first = index;
+                    highest = index;
+                    mark(index);
+                    return;
+                }
+                if (index > highest && index - highest >= WINDOW)
+                {
+                    // Nothing of the window outlives this gap: settle it in one pass, and count the
+                    // part of the gap that is already out of the window as the start of a run
+                    settle();
+                    stats.lost += index - highest - 1;
+                    run = index - WINDOW - highest;
+                    std::fill(seen.begin(), seen.end(), 0);
+                    first = index - WINDOW + 1;
+                    highest = index;
+                    mark(index);
+                }
+                else if (index > highest)
+                {
+                    // Every index between the previous highest and this one is missing for now
+                    while (highest < index)
+                    {
+                        ++highest;
+                        if (highest - first >= WINDOW)
+                        {
+                            settle_index(highest - WINDOW);
+                        }
+                        seen[highest % WINDOW] = 0;
+                        if (highest != index)
+                        {
+                            ++stats.lost;
+                        }
+                    }
+                    mark(index);
+                }
+                else if (index < first || highest - index >= WINDOW)
+                {
+                    ++stats.late;
+                }
+                else if (seen[index % WINDOW])
+                {
+                    ++stats.duplicates;
+                }
+                else
+                {
+                    --stats.lost;
+                    ++stats.reordered;
+                    mark(index);
+                }
+            }
+
+            void mark(
+                    uint32_t index)
+            {
+                seen[index % WINDOW] = 1;
+                ++stats.received;
+            }
+
+            //!index leaves the window: a received one ends the current run of losses
+            void settle_index(
+                    uint32_t index)
+            {
+                if (!seen[index % WINDOW])
+                {
+                    ++run;
+                }
+                else if (run > 0)
+                {
+                    stats.add_burst(run);
+                    run = 0;
+                }
+            }
+
+            //!Settle the whole window. The highest index is received, so the last run ends there and
+            //!the window restarts at it: settling twice counts nothing twice
+            void settle()
+            {
+                if (!started)
+                {
+                    return;
+                }
+                uint32_t start = highest - first >= WINDOW ? highest - WINDOW + 1 : first;
+                for (uint32_t index = start; index != highest + 1; ++index)
+                {
+                    settle_index(index);
+                }
+                first = highest;
+            }
+        };
+
+        std::mutex mutex_;
+        std::map<eprosima::fastdds::rtps::InstanceHandle_t, WriterSequence> writers_;
+        eprosima::fastdds::rtps::InstanceHandle_t last_writer_;
+        WriterSequence* last_ = nullptr;
+};
+
+#endif // SEQUENCE_TRACKER_HPP
@@ -0,0 +1,138 @@
+// Microbenchmark of the generated Minimal serialization against MinimalFastPubSubType
+// Checks that both produce the same bytes and reports their throughput from 1 KB to 32 MB.
+
+#include "MinimalPubSubTypes.hpp"
+#include "minimal_fast_types.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <fastdds/rtps/common/SerializedPayload.hpp>
+
+using namespace eprosima::fastdds::dds;
+using namespace eprosima::fastdds::rtps;
+
+typedef std::chrono::steady_clock bench_clock;
+
+// Results of one serializer for one payload size
+struct Timing
+{
+    double serialize_ns;
+    double deserialize_ns;
+    double size_ns;
+};
+
+//!Average time of iterations calls of op, in nanoseconds
+template<typename Op>
+static double time_ns(
+        uint32_t iterations,
+        Op op)
+{
+    auto start = bench_clock::now();
+    for (uint32_t i = 0; i < iterations; ++i)
+    {
+        op();
+    }
+    return std::chrono::duration<double, std::nano>(bench_clock::now() - start).count() / iterations;
+}
+
+static Timing measure(
+        TopicDataType& type,
+        const Minimal& sample,
+        SerializedPayload_t& payload,
+        DataRepresentationId_t representation,
+        uint32_t iterations)
+{
+    Minimal received;
+    volatile uint32_t size_sink = 0;
+    Timing timing;
+    timing.serialize_ns = time_ns(iterations, [&]()
+                    {
+                        type.serialize(&sample, payload, representation);
+                    });
+    timing.deserialize_ns = time_ns(iterations, [&]()
+                    {
+                        type.deserialize(payload, &received);
+                    });
+    timing.size_ns = time_ns(iterations, [&]()
+                    {
+                        size_sink = type.calculate_serialized_size(&sample, representation);
+                    });
+    static_cast<void>(size_sink);
+    return timing;
+}
+
+//!Both serializers must produce the same bytes, and read each other's output
+static bool check_compatible(
+        MinimalPubSubType& generated,
+        MinimalFastPubSubType& fast,
+        const Minimal& sample,
+        DataRepresentationId_t representation)
+{
+    uint32_t size = generated.calculate_serialized_size(&sample, representation);
+    SerializedPayload_t expected(size);
+    SerializedPayload_t actual(size);
+    if (size != fast.calculate_serialized_size(&sample, representation) ||
+            !generated.serialize(&sample, expected, representation) ||
+            !fast.serialize(&sample, actual, representation) ||
+            expected.length != actual.length ||
+            std::memcmp(expected.data, actual.data, expected.length) != 0)
+    {
+        return false;
+    }
+
+    Minimal from_generated;
+    Minimal from_fast;
+    return fast.deserialize(expected, &from_generated) && generated.deserialize(actual, &from_fast) &&
+           from_generated == sample && from_fast == sample;
+}
+
+int main()
+{
+    const uint32_t sizes[] = {1024, 16 * 1024, 64 * 1024, 256 * 1024, 1024 * 1024,
+                              4 * 1024 * 1024, 8 * 1024 * 1024, 32 * 1024 * 1024};
+    MinimalPubSubType generated;
+    MinimalFastPubSubType fast;
+
+    std::printf("%10s %6s | %12s %12s | %12s %12s | %10s %10s\n", "bytes", "repr",
+            "gen ser GB/s", "fast ser", "gen deser", "fast deser", "gen size ns", "fast size");
+    for (uint32_t size : sizes)
+    {
+        Minimal sample;
+        sample.stream_id(3);
+        sample.index(42);
+        sample.time_stamp(0x0123456789ABCDEFULL);
+        sample.raw_size(size);
+        sample.img_data().resize(size);
+        std::iota(sample.img_data().begin(), sample.img_data().end(), 0);
+
+        // About 1 GB of payload per measurement, at least 5 rounds
+        uint32_t iterations = std::max<uint32_t>(5, (1u << 30) / size);
+
+        const DataRepresentationId_t representations[] = {XCDR2_DATA_REPRESENTATION, XCDR_DATA_REPRESENTATION};
+        for (DataRepresentationId_t representation : representations)
+        {
+            const char* name = representation == XCDR_DATA_REPRESENTATION ? "XCDR1" : "XCDR2";
+            if (!check_compatible(generated, fast, sample, representation))
+            {
+                std::printf("%10u %6s | MISMATCH between generated and fast serialization\n", size, name);
+                return 1;
+            }
+
+            SerializedPayload_t payload(generated.calculate_serialized_size(&sample, representation));
+            Timing gen = measure(generated, sample, payload, representation, iterations);
+            Timing fst = measure(fast, sample, payload, representation, iterations);
+            std::printf("%10u %6s | %12.2f %12.2f | %12.2f %12.2f | %10.1f %10.1f\n", size, name,
+                    size / gen.serialize_ns, size / fst.serialize_ns,
+                    size / gen.deserialize_ns, size / fst.deserialize_ns,
+                    gen.size_ns, fst.size_ns);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,97 @@
+// Lock-free single-producer/single-consumer ring buffer
+
+#ifndef SPSC_RING_HPP
+#define SPSC_RING_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+// Bounded FIFO for exactly one producer thread and one consumer thread.
+// push() and pop() never block nor allocate, so the producer side can be called
+// from latency sensitive contexts such as DDS listener callbacks.
+template<typename T>
+class SpscRing
+{
+    public:
+        // Capacity is rounded up to a power of two
+        explicit SpscRing(
+                size_t capacity)
+            : head_(0)
+            , tail_(0)
+        {
+            size_t size = 2;
+            while (size < capacity)
+            {
+                size <<= 1;
+            }
+            buffer_.resize(size);
+            mask_ = size - 1;
+        }
+
+        //!Producer side: false when the ring is full
+        bool push(
+                const T& item)
+        {
+            const size_t tail = tail_.load(std::memory_order_relaxed);
+            if (tail - head_.load(std::memory_order_acquire) > mask_)
+            {
+                return false;
+            }
+            buffer_[tail & mask_] = item;
+            tail_.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        //!Consumer side: false when the ring is empty
+        bool pop(
+                T& item)
+        {
+            const size_t head = head_.load(std::memory_order_relaxed);
+            if (head == tail_.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+            item = buffer_[head & mask_];
+            head_.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        //!Consumer side: move up to max_items into out, returns how many were moved
+        size_t pop_bulk(
+                T* out,
+                size_t max_items)
+        {
+            const size_t head = head_.load(std::memory_order_relaxed);
+            size_t available = tail_.load(std::memory_order_acquire) - head;
+            if (available > max_items)
+            {
+                available = max_items;
+            }
+            for (size_t i = 0; i < available; ++i)
+            {
+                out[i] = buffer_[(head + i) & mask_];
+            }
+            head_.store(head + available, std::memory_order_release);
+            return available;
+        }
+
+        size_t size() const
+        {
+            return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+        }
+
+        size_t capacity() const
+        {
+            return mask_ + 1;
+        }
+
+    private:
+        std::vector<T> buffer_;
+        size_t mask_;
+        // Indexes grow forever and are masked on access; each one lives in its own cache line
+        alignas(64) std::atomic<size_t> head_;
+        alignas(64) std::atomic<size_t> tail_;
+};
+
+#endif // SPSC_RING_HPP
@@ -0,0 +1,72 @@
+// CPU pinning helpers for the publisher/subscriber threads
+
+#ifndef THREAD_AFFINITY_HPP
+#define THREAD_AFFINITY_HPP
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <pthread.h>
+#include <sched.h>
+
+//!Parse a CPU list such as "2,3,8-11", false on malformed input or a CPU id outside 0 to CPU_SETSIZE - 1
+inline bool parse_cpu_list(
+        const std::string& text,
+        std::vector<int>& cpus)
+{
+    cpus.clear();
+    std::istringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ','))
+    {
+        char* end = nullptr;
+        long first = std::strtol(item.c_str(), &end, 10);
+        long last = first;
+        if (end == item.c_str() || first < 0)
+        {
+            return false;
+        }
+        if (*end == '-')
+        {
+            const char* range = end + 1;
+            last = std::strtol(range, &end, 10);
+            if (end == range || last < first)
+            {
+                return false;
+            }
+        }
+        if (*end != '\0')
+        {
+            return false;
+        }
+        if (last >= CPU_SETSIZE)
+        {
+            std::cout << "CPU id " << last << " is out of range, the highest is " << CPU_SETSIZE - 1 << std::endl;
+            return false;
+        }
+        for (long cpu = first; cpu <= last; ++cpu)
+        {
+            cpus.push_back(static_cast<int>(cpu));
+        }
+    }
+    return !cpus.empty();
+}
+
+//!Restrict the calling thread to one CPU, false when it cannot (CPU_SET is undefined outside the set)
+inline bool pin_current_thread(
+        int cpu)
+{
+    if (cpu < 0 || cpu >= CPU_SETSIZE)
+    {
+        return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+}
+
+#endif // THREAD_AFFINITY_HPP